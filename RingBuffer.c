@@ -10,12 +10,238 @@
  */
 
 #include "RingBuffer.h"
+#include "RingBuffer_Copy.h"
+#include "RingBuffer_Group.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RINGBUF_HAS_OS_WAIT 1
+#include <sched.h>
+#include <time.h>
+#endif
 
 /**
  * @addtogroup RING_BUF
  * @{
  */
 
+/// Iterations of pure spinning before the waiters start backing off
+#define RINGBUF_WAIT_SPIN_ROUNDS 1024u
+
+/**
+ * @brief One wait step of the blocking variants
+ * @note Dispatches on the ring's #RINGBUF_WAIT strategy. The default
+ *       SLEEP_BACKOFF spins for the first #RINGBUF_WAIT_SPIN_ROUNDS
+ *       rounds, then yields, then sleeps with exponentially growing
+ *       naps up to 1ms, so a loaded pipeline stays near spin latency
+ *       while an idle one drops to near-zero CPU. Time bookkeeping is
+ *       approximate; SPIN mode in particular only estimates, so treat
+ *       timeouts there as coarse
+ *
+ * @param[in] rb #RINGBUF_t structure instance
+ * @param[in,out] round Attempt counter, owned by the wait loop
+ * @param[in,out] elapsed_us Accumulated waiting time [us]
+ */
+static void ringbuf_wait_step(RINGBUF_t *rb, u32_t *round, u64_t *elapsed_us) {
+    u32_t r = (*round)++;
+    switch (rb->wait) {
+    case RINGBUF_WAIT_SPIN:
+        // rough bookkeeping only, so the timeouts still fire
+        if ((r & 1023u) == 1023u)
+            *elapsed_us += 1;
+        return;
+    case RINGBUF_WAIT_CALLBACK:
+        if (rb->wait_fn) {
+            rb->wait_fn(r, elapsed_us, rb->wait_arg);
+            return;
+        }
+        break; // no hook installed: fall through to the default
+    case RINGBUF_WAIT_SPIN_THEN_YIELD:
+        if (r < RINGBUF_WAIT_SPIN_ROUNDS)
+            return; // busy spin, costs nothing to wake from
+#ifdef RINGBUF_HAS_OS_WAIT
+        sched_yield();
+#endif
+        *elapsed_us += 1; // bookkeeping only, yields are cheap
+        return;
+    case RINGBUF_WAIT_SLEEP_BACKOFF:
+    default:
+        break;
+    }
+    if (r < RINGBUF_WAIT_SPIN_ROUNDS)
+        return; // busy spin, costs nothing to wake from
+#ifdef RINGBUF_HAS_OS_WAIT
+    if (r < RINGBUF_WAIT_SPIN_ROUNDS + 64) {
+        sched_yield();
+        *elapsed_us += 1; // bookkeeping only, yields are cheap
+        return;
+    }
+    // exponential naps: 1us doubling up to 1ms
+    u32_t shift = r - RINGBUF_WAIT_SPIN_ROUNDS - 64;
+    u64_t nap_us = (shift < 10) ? (1ull << shift) : 1000ull;
+    struct timespec ts = { 0, (long)(nap_us * 1000ull) };
+    nanosleep(&ts, NULL);
+    *elapsed_us += nap_us;
+#else
+    // no OS to park on: account a rough microsecond per spin round
+    *elapsed_us += 1;
+#endif
+}
+
+#ifdef RINGBUF_STATS
+
+/// Plain unsynchronized counter bumps; compile away without RINGBUF_STATS
+#define RINGBUF_STAT_INC(rb, f) ((rb)->stats.f++)
+
+/**
+ * @brief Per-put fill tracking: max level always, histogram sampled
+ * @note Runs after the put updated head. The max-fill compare is one
+ *       predictable branch; the histogram bucket is only computed on
+ *       every 2^RINGBUF_STATS_SAMPLE_SHIFT put, keyed off the puts
+ *       counter so no extra state is needed
+ */
+static void ringbuf_stat_fill(RINGBUF_t *rb) {
+    size_t avail;
+    if (rb->mask)
+        avail = rb->head - rb->tail;
+    else
+        avail = (rb->head < rb->tail) ? rb->size - rb->tail + rb->head
+                                      : rb->head - rb->tail;
+    if (avail > rb->stats.max_fill)
+        rb->stats.max_fill = avail;
+    if (rb->stats.puts & ((1u << RINGBUF_STATS_SAMPLE_SHIFT) - 1))
+        return;
+    size_t bucket = avail * RINGBUF_STATS_BUCKETS / rb->size;
+    if (bucket >= RINGBUF_STATS_BUCKETS)
+        bucket = RINGBUF_STATS_BUCKETS - 1;
+    rb->stats.fill_hist[bucket]++;
+}
+
+#define RINGBUF_STAT_PUT(rb)  (RINGBUF_STAT_INC(rb, puts), ringbuf_stat_fill(rb))
+
+/**
+ * @brief Snapshot the instrumentation counters
+ * @note Copies while the ring may be hot: individual counters are
+ *       consistent, cross-counter relations may be off by an
+ *       operation or two
+ *
+ * @param[out] out Counter snapshot
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_GetStats(RINGBUF_COUNTERS_t *out, RINGBUF_t *rb) {
+    if (rb->buf == NULL || out == NULL) return RINGBUF_PARAM_ERR;
+    *out = rb->stats;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Zero the instrumentation counters
+ *
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_ResetStats(RINGBUF_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    memset(&rb->stats, 0, sizeof(rb->stats));
+    return RINGBUF_OK;
+}
+
+#else
+
+#define RINGBUF_STAT_INC(rb, f) ((void)0)
+#define RINGBUF_STAT_PUT(rb)    ((void)0)
+
+#endif /* RINGBUF_STATS */
+
+/**
+ * @brief Copy data into the ring storage starting at a buffer index
+ * @note Handles the wrap at rb->size with at most two memcpy calls,
+ *       touches no head/tail state
+ */
+static void ringbuf_copy_in(RINGBUF_t *rb, size_t idx, const char *input, size_t len) {
+    if (rb->mirror) { // second mapping absorbs the wrap: one plain copy
+        ringbuf_copy(&rb->buf[idx * rb->cell_size], input, len * rb->cell_size);
+        return;
+    }
+    // available space in the end of buffer
+    size_t space = rb->size - idx;
+    size_t s_addr = 0;
+    if (len > space) { // if len > available space
+        ringbuf_copy(&rb->buf[idx * rb->cell_size], &input[s_addr * rb->cell_size], space * rb->cell_size);
+        idx = 0;
+        s_addr = space;
+        len -= space;
+    }
+    ringbuf_copy(&rb->buf[idx * rb->cell_size], &input[s_addr * rb->cell_size], len * rb->cell_size);
+}
+
+/**
+ * @brief Copy data out of the ring storage starting at a buffer index
+ * @note Handles the wrap at rb->size with at most two memcpy calls,
+ *       touches no head/tail state
+ */
+static void ringbuf_copy_out(RINGBUF_t *rb, size_t idx, char *output, size_t len) {
+    if (rb->mirror) { // second mapping absorbs the wrap: one plain copy
+        ringbuf_copy(output, &rb->buf[idx * rb->cell_size], len * rb->cell_size);
+        return;
+    }
+    // available data in the end of buffer
+    size_t space = rb->size - idx;
+    size_t s_addr = 0;
+    if (len > space) { // if len > available space
+        ringbuf_copy(&output[s_addr * rb->cell_size], &rb->buf[idx * rb->cell_size], space * rb->cell_size);
+        idx = 0;
+        s_addr = space;
+        len -= space;
+    }
+    ringbuf_copy(&output[s_addr * rb->cell_size], &rb->buf[idx * rb->cell_size], len * rb->cell_size);
+}
+
+/**
+ * @brief Enforce the overflow policy before writing len cells
+ * @note In OVERWRITE_OLDEST mode this advances tail to make room,
+ *       dropping the oldest unread cells
+ * @return #RINGBUF_OK when the write may proceed
+ */
+static RINGBUF_STATUS ringbuf_check_policy(RINGBUF_t *rb, size_t len) {
+    if (rb->policy == RINGBUF_POLICY_UNCHECKED)
+        return RINGBUF_OK;
+    size_t avail;
+    if (rb->mask)
+        avail = rb->head - rb->tail;
+    else
+        avail = (rb->head < rb->tail) ? rb->size - rb->tail + rb->head
+                                      : rb->head - rb->tail;
+    // in classic mode one cell stays free so full never aliases empty
+    size_t cap = rb->mask ? rb->size : rb->size - 1;
+    if (len > cap)
+        return RINGBUF_OVERFLOW;
+    size_t free = cap - avail;
+    if (len <= free)
+        return RINGBUF_OK;
+    if (rb->policy == RINGBUF_POLICY_DROP_NEWEST) {
+        RINGBUF_STAT_INC(rb, overflows);
+        return RINGBUF_OVERFLOW;
+    }
+    // OVERWRITE_OLDEST: flush just enough of the oldest data
+    rb->tail += len - free;
+    if (!rb->mask && rb->tail >= rb->size)
+        rb->tail -= rb->size;
+    rb->read_total += len - free; // evicted cells count as consumed
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Mark the ring ready in its group
+ * @note Called by the put paths on the empty-to-non-empty transition
+ *       only, so grouped rings cost one predictable branch per put and
+ *       the atomic OR fires once per burst
+ */
+static inline void ringbuf_group_notify(RINGBUF_t *rb, bool was_empty) {
+    if (rb->group && was_empty)
+        atomic_fetch_or_explicit(&rb->group->ready, 1ull << rb->group_bit, memory_order_release);
+}
+
 /**
  * @brief Init ring buffer
  *
@@ -26,13 +252,75 @@
  * @return #RINGBUF_STATUS enum
  */
 RINGBUF_STATUS RingBuf_Init(void *buf, u16_t size, size_t cellsize, RINGBUF_t *rb) {
+    return RingBuf_InitEx(buf, size, cellsize, rb);
+}
+
+/**
+ * @brief Init ring buffer with full-width capacity
+ * @note Same as #RingBuf_Init without the 64K-cell cap of the u16_t API
+ *
+ * @param[in] buf Pointer to the allocated buffer
+ * @param[in] size Size of buffer [cells]
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_InitEx(void *buf, size_t size, size_t cellsize, RINGBUF_t *rb) {
     rb->size = size; // size of array
     rb->cell_size = cellsize; // size of 1 cell of array
     rb->buf = buf;      // set pointer to buffer
+    rb->mask = 0;       // classic compare-and-reset wrapping
+    rb->policy = RINGBUF_POLICY_UNCHECKED; // no fill check by default
+    rb->mirror = 0;     // plain single mapping
+    rb->mapped = 0;     // not file-backed
+    rb->ext_head = 0;   // head owned by the put calls
+    rb->ts = NULL;      // no per-cell timestamps
+    rb->group = NULL;   // not registered in any group
+    rb->group_bit = 0;
+    rb->wait = RINGBUF_WAIT_SLEEP_BACKOFF; // frugal default for the blocking calls
+    rb->wait_fn = NULL;
+    rb->wait_arg = NULL;
+#ifdef RINGBUF_STATS
+    memset(&rb->stats, 0, sizeof(rb->stats));
+#endif
     RingBuf_Clear(rb); // clear all
     return rb->buf ? RINGBUF_OK : RINGBUF_PARAM_ERR;
 }
 
+/**
+ * @brief Init ring buffer in power-of-two mode
+ * @note Head/tail become free-running counters and every index is
+ *       wrapped with `& mask` instead of a compare-and-reset branch,
+ *       so full vs empty is unambiguous and all size cells are usable
+ *
+ * @param[in] buf Pointer to the allocated buffer
+ * @param[in] size Size of buffer, must be a power of two
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_InitPow2(void *buf, u16_t size, size_t cellsize, RINGBUF_t *rb) {
+    return RingBuf_InitPow2Ex(buf, size, cellsize, rb);
+}
+
+/**
+ * @brief Init ring buffer in power-of-two mode, full-width capacity
+ * @note Same as #RingBuf_InitPow2 without the 64K-cell cap
+ *
+ * @param[in] buf Pointer to the allocated buffer
+ * @param[in] size Size of buffer [cells], must be a power of two
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_InitPow2Ex(void *buf, size_t size, size_t cellsize, RINGBUF_t *rb) {
+    if (size == 0 || (size & (size - 1)) != 0) // not a power of two
+        return RINGBUF_PARAM_ERR;
+    RINGBUF_STATUS st = RingBuf_InitEx(buf, size, cellsize, rb);
+    rb->mask = size - 1;
+    return st;
+}
+
 /**
  * @brief Clear ring buffer
  * @note Disable interrupts while clearing
@@ -43,6 +331,60 @@ RINGBUF_STATUS RingBuf_Init(void *buf, u16_t size, size_t cellsize, RINGBUF_t *r
 RINGBUF_STATUS RingBuf_Clear(RINGBUF_t *rb) {
     if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
     rb->head = rb->tail = 0;
+    rb->put_total = rb->read_total = 0;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Set the overflow policy of the buffer
+ * @note #RINGBUF_POLICY_OVERWRITE_OLDEST keeps the latest data
+ *       (telemetry rings), #RINGBUF_POLICY_DROP_NEWEST rejects puts
+ *       that do not fit, #RINGBUF_POLICY_UNCHECKED skips the fill
+ *       check entirely. In classic mode the checked policies keep one
+ *       cell free, so usable capacity is size-1.
+ *
+ * @param[in] policy #RINGBUF_POLICY enum
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SetPolicy(RINGBUF_POLICY policy, RINGBUF_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    rb->policy = policy;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Set the waiting strategy of the buffer
+ * @note Applies to the blocking variants and the Wait primitives;
+ *       #RINGBUF_WAIT_SLEEP_BACKOFF is the default after init. Set it
+ *       before the blocking calls start, like the overflow policy
+ *
+ * @param[in] wait #RINGBUF_WAIT enum
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SetWait(RINGBUF_WAIT wait, RINGBUF_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    rb->wait = wait;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Install a user wait hook and select #RINGBUF_WAIT_CALLBACK
+ * @note For platforms with their own idle primitive (WFE/WFI, event
+ *       flags): the hook runs once per failed attempt and should add
+ *       the waited time to *elapsed_us so the timeouts keep working
+ *
+ * @param[in] fn Hook, see #RINGBUF_WAIT_FN
+ * @param[in] arg User argument passed through to the hook
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SetWaitCallback(RINGBUF_WAIT_FN fn, void *arg, RINGBUF_t *rb) {
+    if (rb->buf == NULL || fn == NULL) return RINGBUF_PARAM_ERR;
+    rb->wait_fn = fn;
+    rb->wait_arg = arg;
+    rb->wait = RINGBUF_WAIT_CALLBACK;
     return RINGBUF_OK;
 }
 
@@ -54,7 +396,25 @@ RINGBUF_STATUS RingBuf_Clear(RINGBUF_t *rb) {
  * @return #RINGBUF_STATUS enum
  */
 RINGBUF_STATUS RingBuf_Available(u16_t *len, RINGBUF_t *rb) {
+    size_t avail = 0;
+    RINGBUF_STATUS st = RingBuf_AvailableEx(&avail, rb);
+    *len = (avail > 0xFFFF) ? 0xFFFF : (u16_t)avail; // clamp for big rings
+    return st;
+}
+
+/**
+ * @brief Check available size to read, full-width
+ *
+ * @param[out] len Size to read [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_AvailableEx(size_t *len, RINGBUF_t *rb) {
     if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    if (rb->mask) { // free-running counters: plain difference
+        *len = rb->head - rb->tail;
+        return RINGBUF_OK;
+    }
     if (rb->head < rb->tail)
         *len = rb->size - rb->tail + rb->head;
     else
@@ -62,6 +422,23 @@ RINGBUF_STATUS RingBuf_Available(u16_t *len, RINGBUF_t *rb) {
     return RINGBUF_OK;
 }
 
+/**
+ * @brief Read the lifetime statistics of the buffer
+ * @note Counters survive reads but reset with #RingBuf_Clear.
+ *       produced - consumed always equals the current fill level;
+ *       cells evicted by OVERWRITE_OLDEST count as consumed.
+ *
+ * @param[out] stats #RINGBUF_STATS_t snapshot
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_Stats(RINGBUF_STATS_t *stats, RINGBUF_t *rb) {
+    if (rb->buf == NULL || stats == NULL) return RINGBUF_PARAM_ERR;
+    stats->produced = rb->put_total;
+    stats->consumed = rb->read_total;
+    return RINGBUF_OK;
+}
+
 /**
  * @brief Put byte to the buffer
  *
@@ -71,9 +448,30 @@ RINGBUF_STATUS RingBuf_Available(u16_t *len, RINGBUF_t *rb) {
  */
 RINGBUF_STATUS RingBuf_BytePut(const u8_t data, RINGBUF_t *rb) {
     if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
-    rb->buf[rb->head++] = data; // put byte in cell and increment data
-    if (rb->head >= rb->size) // if overflow
-        rb->head = 0;   // set to start
+    RINGBUF_STATUS st = ringbuf_check_policy(rb, 1);
+    if (st != RINGBUF_OK)
+        return st;
+    bool was_empty = (rb->head == rb->tail);
+    if (rb->mask) { // branch-free wrap by masking
+        if ((rb->head & rb->mask) == rb->mask)
+            RINGBUF_STAT_INC(rb, wraps);
+        rb->buf[rb->head++ & rb->mask] = data;
+        rb->put_total++;
+        RINGBUF_STAT_PUT(rb);
+        ringbuf_group_notify(rb, was_empty);
+        return RINGBUF_OK;
+    }
+    rb->buf[rb->head] = data; // put byte in cell
+    // publish the new head with a single store
+    if (rb->head + 1 >= rb->size) {
+        rb->head = 0;
+        RINGBUF_STAT_INC(rb, wraps);
+    } else {
+        rb->head = rb->head + 1;
+    }
+    rb->put_total++;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, was_empty);
     return RINGBUF_OK;
 }
 
@@ -89,6 +487,11 @@ RINGBUF_STATUS RingBuf_CellPut(const void *data, RINGBUF_t *rb) {
 
 /**
  * @brief Put some data to the buffer
+ * @note Safe against a concurrent reader of head (e.g. an ISR calling
+ *       #RingBuf_Available or #RingBuf_DataRead on the other side):
+ *       wrapped writes are computed in locals and head is published
+ *       with a single store after the data is in place, so the fill
+ *       level never transiently shrinks mid-put
  *
  * @param[in] data Data to be put
  * @param[in] len Length of data to be written [bytes]
@@ -96,30 +499,93 @@ RINGBUF_STATUS RingBuf_CellPut(const void *data, RINGBUF_t *rb) {
  * @return #RINGBUF_STATUS enum
  */
 RINGBUF_STATUS RingBuf_DataPut(const void *data, u16_t len, RINGBUF_t *rb) {
+    return RingBuf_DataPutEx(data, len, rb);
+}
+
+/**
+ * @brief Put some data to the buffer, full-width length
+ * @note Same as #RingBuf_DataPut without the 64K-cell transfer cap
+ *
+ * @param[in] data Data to be put
+ * @param[in] len Length of data to be written [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_DataPutEx(const void *data, size_t len, RINGBUF_t *rb) {
     if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
-    if (len > rb->size)
+    if (len > rb->size) {
+        RINGBUF_STAT_INC(rb, overflows);
         return RINGBUF_OVERFLOW;
-    const char *input = data; // recast pointer
-    // INPUT data index start address
-    size_t s_addr = 0;
-    // available space in the end of buffer
-    size_t space = rb->size - rb->head;
-    if (len > space) { // if len > available space
-        // copy data to available space
-        memcpy(&rb->buf[rb->head*rb->cell_size], &input[s_addr * rb->cell_size], space * rb->cell_size);
-        // next writing will start from 0
-        rb->head = 0;
-        // new start address = space length
-        s_addr = space;
-        // new length = len-space
-        len -= space;
     }
-    // copy all the data to the buf storage
-    memcpy(&rb->buf[rb->head*rb->cell_size], &input[s_addr * rb->cell_size], len * rb->cell_size);
-    // shift to the next head
-    rb->head += len;
-    if (rb->head >= rb->size)
-        rb->head = 0;
+    RINGBUF_STATUS pst = ringbuf_check_policy(rb, len);
+    if (pst != RINGBUF_OK)
+        return pst;
+    bool was_empty = (rb->head == rb->tail);
+    if (rb->mask) { // masked indices, head runs free
+        if ((rb->head & rb->mask) + len > rb->size)
+            RINGBUF_STAT_INC(rb, wraps);
+        ringbuf_copy_in(rb, rb->head & rb->mask, data, len);
+        rb->head += len;
+        rb->put_total += len;
+        RINGBUF_STAT_PUT(rb);
+        ringbuf_group_notify(rb, was_empty && len);
+        return RINGBUF_OK;
+    }
+    // copy first, wrapping in locals only
+    ringbuf_copy_in(rb, rb->head, data, len);
+    // publish the new head exactly once, after all the data is in place
+    size_t head = rb->head + len;
+    if (head >= rb->size) {
+        head -= rb->size;
+        RINGBUF_STAT_INC(rb, wraps);
+    }
+    rb->head = head;
+    rb->put_total += len;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, was_empty && len);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Put as much data as fits in one pass
+ * @note One fused fill-check and copy: head and tail are loaded once,
+ *       the transferable count is reported through actual, and the new
+ *       head is published with a single store. Never overruns unread
+ *       data; in classic mode one cell stays free. A full buffer is
+ *       not an error: actual is 0 and the call returns #RINGBUF_OK.
+ *
+ * @param[in] data Data to be put
+ * @param[in] len Length of data offered [cells]
+ * @param[out] actual Cells actually written
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_DataPutUpTo(const void *data, u16_t len, u16_t *actual, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL || actual == NULL)
+        return RINGBUF_PARAM_ERR;
+    size_t head = rb->head;
+    size_t tail = rb->tail;
+    size_t avail, free;
+    if (rb->mask) {
+        avail = head - tail;
+        free = rb->size - avail;
+    } else {
+        avail = (head < tail) ? rb->size - tail + head : head - tail;
+        free = rb->size - 1 - avail; // one cell stays free
+    }
+    size_t n = (len < free) ? len : free;
+    *actual = (u16_t)n;
+    if (n == 0)
+        return RINGBUF_OK;
+    ringbuf_copy_in(rb, rb->mask ? (head & rb->mask) : head, data, n);
+    // publish the new head with a single store
+    head += n;
+    if (!rb->mask && head >= rb->size)
+        head -= rb->size;
+    rb->head = head;
+    rb->put_total += n;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, avail == 0);
     return RINGBUF_OK;
 }
 
@@ -135,9 +601,13 @@ RINGBUF_STATUS RingBuf_ByteRead(u8_t *data, RINGBUF_t *rb) {
     RINGBUF_STATUS st = RingBuf_ByteWatch(data, rb);
     if (st != RINGBUF_OK)
         return st;
-    rb->tail++;
-    if (rb->tail >= rb->size)
-        rb->tail = 0;
+    // publish the new tail with a single store
+    size_t tail = rb->tail + 1;
+    if (!rb->mask && tail >= rb->size) // free-running in pow2 mode
+        tail = 0;
+    rb->tail = tail;
+    rb->read_total++;
+    RINGBUF_STAT_INC(rb, reads);
     return st;
 }
 
@@ -153,6 +623,9 @@ RINGBUF_STATUS RingBuf_CellRead(void *data, RINGBUF_t *rb) {
 
 /**
  * @brief Read some next data from the buffer
+ * @note Safe against a concurrent writer of the opposite index, same
+ *       guarantee as #RingBuf_DataPut: the new tail is computed in a
+ *       local and published with a single store after the copy-out
  *
  * @param[out] data Data from the buffer
  * @param[in] len Length of data to be read [bytes]
@@ -160,18 +633,350 @@ RINGBUF_STATUS RingBuf_CellRead(void *data, RINGBUF_t *rb) {
  * @return #RINGBUF_STATUS enum
  */
 RINGBUF_STATUS RingBuf_DataRead(void *data, u16_t len, RINGBUF_t *rb) {
+    return RingBuf_DataReadEx(data, len, rb);
+}
+
+/**
+ * @brief Read some next data from the buffer, full-width length
+ * @note Same as #RingBuf_DataRead without the 64K-cell transfer cap
+ *
+ * @param[out] data Data from the buffer
+ * @param[in] len Length of data to be read [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_DataReadEx(void *data, size_t len, RINGBUF_t *rb) {
     if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
     // read data
-    RINGBUF_STATUS st = RingBuf_DataWatch(data, len, rb);
+    RINGBUF_STATUS st = RingBuf_DataWatchEx(data, len, rb);
     if (st != RINGBUF_OK)
         return st;
-    // shift to the next head
-    rb->tail += len;
-    if (rb->tail >= rb->size)
-        rb->tail = 0;
+    // publish the new tail exactly once, wrapping in a local
+    size_t tail = rb->tail + len;
+    if (!rb->mask && tail >= rb->size) // free-running in pow2 mode
+        tail -= rb->size;
+    rb->tail = tail;
+    rb->read_total += len;
+    RINGBUF_STAT_INC(rb, reads);
     return st;
 }
 
+/**
+ * @brief Claim a zero-copy write region in the ring storage
+ * @note Write up to @p contig_len cells directly through @p ptr
+ *       (e.g. as a DMA or read() destination), then publish them
+ *       with #RingBuf_WriteCommit. No data is copied here. The claim
+ *       is clamped to the free space, mirroring #RingBuf_ReadClaim:
+ *       unread cells are never handed out, so the OVERWRITE_OLDEST
+ *       policy cannot apply to zero-copy writes
+ *
+ * @param[in] len Length of region wanted [cells]
+ * @param[out] ptr Pointer into the ring storage at the write point
+ * @param[out] contig_len Contiguous free length, may be < len
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_WriteClaim(u16_t len, u8_t **ptr, u16_t *contig_len, RINGBUF_t *rb) {
+    if (rb->buf == NULL || ptr == NULL || contig_len == NULL)
+        return RINGBUF_PARAM_ERR;
+    size_t avail = 0;
+    RINGBUF_STATUS st = RingBuf_AvailableEx(&avail, rb);
+    if (st != RINGBUF_OK)
+        return st;
+    // free cells; classic mode keeps one free, like the checked puts
+    size_t cap = rb->mask ? rb->size : rb->size - 1;
+    size_t free = cap - avail;
+    if (len > free)
+        len = (u16_t)free;
+    size_t idx = rb->mask ? (rb->head & rb->mask) : rb->head;
+    // contiguous space in the end of buffer (everything, if mirrored)
+    size_t space = rb->mirror ? rb->size : rb->size - idx;
+    *ptr = &rb->buf[idx * rb->cell_size];
+    *contig_len = (len < space) ? len : (u16_t)space;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Commit a region claimed with #RingBuf_WriteClaim
+ * @note Commit no more than the contig_len returned by the claim
+ *
+ * @param[in] len Length of written data [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_WriteCommit(u16_t len, RINGBUF_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    size_t idx = rb->mask ? (rb->head & rb->mask) : rb->head;
+    if (len > (rb->mirror ? rb->size : rb->size - idx))
+        return RINGBUF_OVERFLOW;
+    bool was_empty = (rb->head == rb->tail);
+    // publish the new head with a single store
+    size_t head = rb->head + len;
+    if (!rb->mask && head >= rb->size)
+        head -= rb->size;
+    rb->head = head;
+    rb->put_total += len;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, was_empty && len);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Claim a zero-copy read region in the ring storage
+ * @note Consume up to @p contig_len cells directly through @p ptr
+ *       (e.g. as a writev() source), then flush them with
+ *       #RingBuf_ReadCommit. No data is copied here.
+ *
+ * @param[in] len Length of region wanted [cells]
+ * @param[out] ptr Pointer into the ring storage at the read point
+ * @param[out] contig_len Contiguous length before wrap, may be < len
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_ReadClaim(u16_t len, u8_t **ptr, u16_t *contig_len, RINGBUF_t *rb) {
+    if (rb->buf == NULL || ptr == NULL || contig_len == NULL)
+        return RINGBUF_PARAM_ERR;
+    u16_t avail = 0;
+    RINGBUF_STATUS st = RingBuf_Available(&avail, rb);
+    if (st != RINGBUF_OK)
+        return st;
+    if (len > avail)
+        len = avail;
+    size_t idx = rb->mask ? (rb->tail & rb->mask) : rb->tail;
+    // contiguous data in the end of buffer (everything, if mirrored)
+    size_t space = rb->mirror ? rb->size : rb->size - idx;
+    *ptr = &rb->buf[idx * rb->cell_size];
+    *contig_len = (len < space) ? len : (u16_t)space;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Commit a region claimed with #RingBuf_ReadClaim
+ * @note Commit no more than the contig_len returned by the claim
+ *
+ * @param[in] len Length of consumed data [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_ReadCommit(u16_t len, RINGBUF_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    size_t idx = rb->mask ? (rb->tail & rb->mask) : rb->tail;
+    if (len > (rb->mirror ? rb->size : rb->size - idx))
+        return RINGBUF_OVERFLOW;
+    // publish the new tail with a single store
+    size_t tail = rb->tail + len;
+    if (!rb->mask && tail >= rb->size)
+        tail -= rb->size;
+    rb->tail = tail;
+    rb->read_total += len;
+    RINGBUF_STAT_INC(rb, reads);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Read as much data as is available in one pass, up to max_len
+ * @note One fused fill-check and copy, the safe counterpart of
+ *       #RingBuf_DataRead: never reads past head, reports the
+ *       transferred count through actual. An empty buffer is not an
+ *       error: actual is 0 and the call returns #RINGBUF_OK.
+ *
+ * @param[out] data Data from the buffer
+ * @param[in] max_len Capacity of the output buffer [cells]
+ * @param[out] actual Cells actually read
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_DataReadUpTo(void *data, u16_t max_len, u16_t *actual, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL || actual == NULL)
+        return RINGBUF_PARAM_ERR;
+    size_t head = rb->head;
+    size_t tail = rb->tail;
+    size_t avail;
+    if (rb->mask)
+        avail = head - tail;
+    else
+        avail = (head < tail) ? rb->size - tail + head : head - tail;
+    size_t n = (max_len < avail) ? max_len : avail;
+    *actual = (u16_t)n;
+    if (n == 0)
+        return RINGBUF_OK;
+    ringbuf_copy_out(rb, rb->mask ? (tail & rb->mask) : tail, data, n);
+    // publish the new tail with a single store
+    tail += n;
+    if (!rb->mask && tail >= rb->size)
+        tail -= rb->size;
+    rb->tail = tail;
+    rb->read_total += n;
+    RINGBUF_STAT_INC(rb, reads);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Put some data to the buffer, waiting for free space
+ * @note For use between threads: spins briefly, then backs off (see
+ *       #ringbuf_wait_step) until len cells fit. Space accounting
+ *       keeps one cell free in classic mode, like the checked
+ *       overflow policies.
+ *
+ * @param[in] data Data to be put
+ * @param[in] len Length of data to be written [cells]
+ * @param[in] timeout_ms Timeout [ms], 0 to try once, #RINGBUF_WAIT_FOREVER to wait forever
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_TIMEOUT if space did not appear in time
+ */
+RINGBUF_STATUS RingBuf_DataPutWait(const void *data, u16_t len, u32_t timeout_ms, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    size_t cap = rb->mask ? rb->size : rb->size - 1;
+    if (len > cap)
+        return RINGBUF_OVERFLOW;
+    u32_t round = 0;
+    u64_t elapsed_us = 0;
+    for (;;) {
+        u16_t avail = 0;
+        RingBuf_Available(&avail, rb);
+        if (cap - avail >= len)
+            return RingBuf_DataPut(data, len, rb);
+        if (timeout_ms != RINGBUF_WAIT_FOREVER && elapsed_us >= (u64_t)timeout_ms * 1000ull)
+            return RINGBUF_TIMEOUT;
+        ringbuf_wait_step(rb, &round, &elapsed_us);
+    }
+}
+
+/**
+ * @brief Read some next data from the buffer, waiting for it to arrive
+ * @note For use between threads: spins briefly, then backs off (see
+ *       #ringbuf_wait_step) until len cells are available
+ *
+ * @param[out] data Data from the buffer
+ * @param[in] len Length of data to be read [cells]
+ * @param[in] timeout_ms Timeout [ms], 0 to try once, #RINGBUF_WAIT_FOREVER to wait forever
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_TIMEOUT if data did not arrive in time
+ */
+RINGBUF_STATUS RingBuf_DataReadWait(void *data, u16_t len, u32_t timeout_ms, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    if (len > rb->size)
+        return RINGBUF_OVERFLOW;
+    u32_t round = 0;
+    u64_t elapsed_us = 0;
+    for (;;) {
+        u16_t avail = 0;
+        RingBuf_Available(&avail, rb);
+        if (avail >= len)
+            return RingBuf_DataRead(data, len, rb);
+        if (timeout_ms != RINGBUF_WAIT_FOREVER && elapsed_us >= (u64_t)timeout_ms * 1000ull)
+            return RINGBUF_TIMEOUT;
+        ringbuf_wait_step(rb, &round, &elapsed_us);
+    }
+}
+
+/**
+ * @brief Wait until the buffer has data to read
+ * @note Consumes nothing: pair with the non-blocking reads or the
+ *       zero-copy segment calls. Uses the ring's waiting strategy
+ *
+ * @param[in] timeout_ms Timeout [ms], 0 to try once, #RINGBUF_WAIT_FOREVER to wait forever
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_TIMEOUT if data did not arrive in time
+ */
+RINGBUF_STATUS RingBuf_WaitNotEmpty(u32_t timeout_ms, RINGBUF_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    u32_t round = 0;
+    u64_t elapsed_us = 0;
+    for (;;) {
+        if (rb->head != rb->tail)
+            return RINGBUF_OK;
+        if (timeout_ms != RINGBUF_WAIT_FOREVER && elapsed_us >= (u64_t)timeout_ms * 1000ull)
+            return RINGBUF_TIMEOUT;
+        ringbuf_wait_step(rb, &round, &elapsed_us);
+    }
+}
+
+/**
+ * @brief Wait until at least one cell fits in the buffer
+ * @note Writes nothing: pair with the non-blocking puts or
+ *       claim/commit. Uses the ring's waiting strategy
+ *
+ * @param[in] timeout_ms Timeout [ms], 0 to try once, #RINGBUF_WAIT_FOREVER to wait forever
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_TIMEOUT if space did not appear in time
+ */
+RINGBUF_STATUS RingBuf_WaitNotFull(u32_t timeout_ms, RINGBUF_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    size_t cap = rb->mask ? rb->size : rb->size - 1;
+    u32_t round = 0;
+    u64_t elapsed_us = 0;
+    for (;;) {
+        size_t avail = 0;
+        RingBuf_AvailableEx(&avail, rb);
+        if (avail < cap)
+            return RINGBUF_OK;
+        if (timeout_ms != RINGBUF_WAIT_FOREVER && elapsed_us >= (u64_t)timeout_ms * 1000ull)
+            return RINGBUF_TIMEOUT;
+        ringbuf_wait_step(rb, &round, &elapsed_us);
+    }
+}
+
+/**
+ * @brief Get the readable regions of the ring storage
+ * @note The data between tail and head spans at most two contiguous
+ *       regions; hand them straight to writev()/sendmsg() and flush
+ *       the consumed amount with #RingBuf_Skip. seg2 is NULL when the
+ *       data does not wrap.
+ *
+ * @param[out] seg1 Pointer to the first readable region
+ * @param[out] len1 Length of the first region [cells]
+ * @param[out] seg2 Pointer to the second readable region, or NULL
+ * @param[out] len2 Length of the second region [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_GetReadSegments(u8_t **seg1, u16_t *len1, u8_t **seg2, u16_t *len2, RINGBUF_t *rb) {
+    if (seg1 == NULL || len1 == NULL || seg2 == NULL || len2 == NULL)
+        return RINGBUF_PARAM_ERR;
+    u16_t avail = 0;
+    RINGBUF_STATUS st = RingBuf_Available(&avail, rb);
+    if (st != RINGBUF_OK)
+        return st;
+    size_t idx = rb->mask ? (rb->tail & rb->mask) : rb->tail;
+    // contiguous data in the end of buffer (everything, if mirrored)
+    size_t space = rb->mirror ? rb->size : rb->size - idx;
+    *seg1 = &rb->buf[idx * rb->cell_size];
+    if (avail <= space) { // no wrap: one region
+        *len1 = avail;
+        *seg2 = NULL;
+        *len2 = 0;
+    } else { // wrapped: rest of the data sits at the buffer start
+        *len1 = (u16_t)space;
+        *seg2 = rb->buf;
+        *len2 = (u16_t)(avail - space);
+    }
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Flush data from the buffer without reading it
+ *
+ * @param[in] len Length of data to be flushed [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_OVERFLOW if len exceeds available data
+ */
+RINGBUF_STATUS RingBuf_Skip(u16_t len, RINGBUF_t *rb) {
+    u16_t avail = 0;
+    RINGBUF_STATUS st = RingBuf_Available(&avail, rb);
+    if (st != RINGBUF_OK)
+        return st;
+    if (len > avail)
+        return RINGBUF_OVERFLOW;
+    // publish the new tail with a single store
+    size_t tail = rb->tail + len;
+    if (!rb->mask && tail >= rb->size)
+        tail -= rb->size;
+    rb->tail = tail;
+    rb->read_total += len;
+    return RINGBUF_OK;
+}
+
 /**
  * @brief Watch current byte in buf
  * @note Reads data without shifting in the buffer
@@ -182,7 +987,7 @@ RINGBUF_STATUS RingBuf_DataRead(void *data, u16_t len, RINGBUF_t *rb) {
  */
 RINGBUF_STATUS RingBuf_ByteWatch(u8_t *data, RINGBUF_t *rb) {
     if (data == NULL) return RINGBUF_PARAM_ERR;
-    *data = rb->buf[rb->tail];
+    *data = rb->buf[rb->mask ? (rb->tail & rb->mask) : rb->tail];
     return RINGBUF_OK;
 }
 
@@ -208,28 +1013,560 @@ RINGBUF_STATUS RingBuf_CellWatch(void *data, RINGBUF_t *rb) {
  * @return #RINGBUF_STATUS enum
  */
 RINGBUF_STATUS RingBuf_DataWatch(void *data, u16_t len, RINGBUF_t *rb) {
+    return RingBuf_DataWatchEx(data, len, rb);
+}
+
+/**
+ * @brief Watch current data in the buf, full-width length
+ * @note Same as #RingBuf_DataWatch without the 64K-cell transfer cap
+ * @return #RINGBUF_ERR when len exceeds the fill level: the call never
+ *         reads past head
+ *
+ * @param[out] data Data from buffer
+ * @param[in] len Length of data to be read [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_DataWatchEx(void *data, size_t len, RINGBUF_t *rb) {
     if (data == NULL)
         return RINGBUF_PARAM_ERR;
     if (len > rb->size)
         return RINGBUF_OVERFLOW;
-    // OUTPUT data index start address
-    u16_t s_addr = 0;
-    // available space in the end of buffer
-    u16_t space = rb->size - rb->tail;
-    u16_t loc_tail = rb->tail;
-    if (len > space) { // if len > available space
-        // recast pointer to u8_t
-        // copy data from available space
-        memcpy(&data[s_addr * rb->cell_size], &rb->buf[loc_tail * rb->cell_size], space * rb->cell_size);
-        // next reading will start from 0
-        loc_tail = 0;
-        // new start address - space length
-        s_addr = space;
-        // new length - len-space
-        len -= space;
+    size_t avail = 0;
+    RingBuf_AvailableEx(&avail, rb);
+    if (len > avail) // never hand out cells past head
+        return RINGBUF_ERR;
+    ringbuf_copy_out(rb, rb->mask ? (rb->tail & rb->mask) : rb->tail, data, len);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Watch one byte at an offset from the read point
+ * @note Reads without shifting and without touching any index, so a
+ *       framing parser can probe header fields in place instead of
+ *       copying out the whole available region
+ *
+ * @param[in] offset Offset from tail [cells]
+ * @param[out] data Pointer to data byte got from buffer
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR if offset is past the fill level
+ */
+RINGBUF_STATUS RingBuf_ByteWatchAt(u16_t offset, u8_t *data, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    u16_t avail = 0;
+    RingBuf_Available(&avail, rb);
+    if (offset >= avail)
+        return RINGBUF_ERR;
+    size_t idx = rb->tail + offset;
+    if (rb->mask)
+        idx &= rb->mask;
+    else if (idx >= rb->size)
+        idx -= rb->size;
+    *data = rb->buf[idx];
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Watch data at an offset from the read point
+ * @note Reads without shifting and without touching any index;
+ *       cost is O(len) regardless of the fill level
+ *
+ * @param[in] offset Offset from tail [cells]
+ * @param[out] data Data from buffer
+ * @param[in] len Length of data to be read [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR if the range is past the fill level
+ */
+RINGBUF_STATUS RingBuf_WatchAt(u16_t offset, void *data, u16_t len, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    u16_t avail = 0;
+    RingBuf_Available(&avail, rb);
+    if ((size_t)offset + len > avail)
+        return RINGBUF_ERR;
+    size_t idx = rb->tail + offset;
+    if (rb->mask)
+        idx &= rb->mask;
+    else if (idx >= rb->size)
+        idx -= rb->size;
+    ringbuf_copy_out(rb, idx, data, len);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Put one framed message to the buffer
+ * @note Byte rings only (cell_size 1). Writes a 2-byte length header
+ *       plus the payload in one pass with a single head publish. The
+ *       overflow policy is not applied: a frame either fits whole or
+ *       is rejected, so the ring never holds a partial frame
+ *
+ * @param[in] data Message payload
+ * @param[in] len Payload length [bytes], up to 64K-1
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_OVERFLOW if the frame does not fit
+ */
+RINGBUF_STATUS RingBuf_MsgPut(const void *data, u16_t len, RINGBUF_t *rb) {
+    if (rb->buf == NULL || (data == NULL && len) || rb->cell_size != 1)
+        return RINGBUF_PARAM_ERR;
+    size_t frame = 2u + len;
+    size_t cap = rb->mask ? rb->size : rb->size - 1;
+    size_t avail = 0;
+    RingBuf_AvailableEx(&avail, rb);
+    if (frame > cap - avail) {
+        RINGBUF_STAT_INC(rb, overflows);
+        return RINGBUF_OVERFLOW;
     }
-    // copy all the data from the buf storage
-    memcpy(&data[s_addr * rb->cell_size], &rb->buf[loc_tail * rb->cell_size], len * rb->cell_size);
+    bool was_empty = (rb->head == rb->tail);
+    u16_t hdr = len;
+    size_t head = rb->head;
+    size_t h_idx = rb->mask ? (head & rb->mask) : head;
+    ringbuf_copy_in(rb, h_idx, (const char *)&hdr, 2);
+    size_t p_idx = head + 2;
+    if (rb->mask)
+        p_idx &= rb->mask;
+    else if (p_idx >= rb->size)
+        p_idx -= rb->size;
+    ringbuf_copy_in(rb, p_idx, data, len);
+    // publish the whole frame with one store of head
+    head += frame;
+    if (!rb->mask && head >= rb->size)
+        head -= rb->size;
+    rb->head = head;
+    rb->put_total += frame;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, was_empty);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Read the 2-byte frame header at tail with direct byte loads
+ * @note The header can only split 1+1 at the wrap point, so two plain
+ *       loads cover every case and keep the streaming copy kernel out
+ *       of a 2-byte path (whose inlined wide branches also trip a
+ *       spurious -Wstringop-overflow in optimized builds)
+ */
+static inline u16_t ringbuf_msg_hdr(const RINGBUF_t *rb, size_t tail) {
+    size_t i0 = rb->mask ? (tail & rb->mask) : tail;
+    size_t i1 = i0 + 1;
+    if (rb->mask)
+        i1 &= rb->mask;
+    else if (i1 >= rb->size)
+        i1 = 0;
+    u16_t hdr;
+    ((u8_t *)&hdr)[0] = rb->buf[i0]; // same byte order MsgPut stored
+    ((u8_t *)&hdr)[1] = rb->buf[i1];
+    return hdr;
+}
+
+/**
+ * @brief Peek the payload length of the next framed message
+ * @note Consumes nothing; use to size the read buffer before
+ *       #RingBuf_MsgRead
+ *
+ * @param[out] len Payload length of the next frame [bytes]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR when no frame is buffered
+ */
+RINGBUF_STATUS RingBuf_MsgPeekLen(u16_t *len, RINGBUF_t *rb) {
+    if (rb->buf == NULL || len == NULL || rb->cell_size != 1)
+        return RINGBUF_PARAM_ERR;
+    size_t avail = 0;
+    RingBuf_AvailableEx(&avail, rb);
+    if (avail < 2)
+        return RINGBUF_ERR;
+    *len = ringbuf_msg_hdr(rb, rb->tail);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Read one whole framed message from the buffer
+ * @note Header and payload are consumed in one operation with a
+ *       single tail publish. A frame larger than max is left in the
+ *       buffer and reported via len, so the caller can retry with a
+ *       bigger buffer
+ *
+ * @param[out] data Payload destination
+ * @param[in] max Destination capacity [bytes]
+ * @param[out] len Payload length of the frame [bytes]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR when no complete frame is
+ *         buffered, #RINGBUF_OVERFLOW when the frame exceeds max
+ */
+RINGBUF_STATUS RingBuf_MsgRead(void *data, u16_t max, u16_t *len, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL || len == NULL || rb->cell_size != 1)
+        return RINGBUF_PARAM_ERR;
+    size_t avail = 0;
+    RingBuf_AvailableEx(&avail, rb);
+    if (avail < 2)
+        return RINGBUF_ERR;
+    size_t tail = rb->tail;
+    u16_t hdr = ringbuf_msg_hdr(rb, tail);
+    if (avail < 2u + hdr)
+        return RINGBUF_ERR; // half-written frame: producer still busy
+    *len = hdr;
+    if (hdr > max) {
+        return RINGBUF_OVERFLOW; // frame stays buffered for a retry
+    }
+    size_t p_idx = tail + 2;
+    if (rb->mask)
+        p_idx &= rb->mask;
+    else if (p_idx >= rb->size)
+        p_idx -= rb->size;
+    ringbuf_copy_out(rb, p_idx, data, hdr);
+    // flush the whole frame with one store of tail
+    tail += 2u + hdr;
+    if (!rb->mask && tail >= rb->size)
+        tail -= rb->size;
+    rb->tail = tail;
+    rb->read_total += 2u + hdr;
+    RINGBUF_STAT_INC(rb, reads);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Put scattered segments to the buffer in one transaction
+ * @note Walks the iovec list with the wrap handled per segment and
+ *       publishes head once at the end, so a header + payload pair
+ *       costs one call and one index update instead of two of each.
+ *       The overflow policy applies to the combined length: segments
+ *       land either all or not at all
+ *
+ * @param[in] iov Segments to gather, #RINGBUF_IOV_t array
+ * @param[in] iovcnt Number of segments
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_DataPutV(const RINGBUF_IOV_t *iov, size_t iovcnt, RINGBUF_t *rb) {
+    if (rb->buf == NULL || iov == NULL)
+        return RINGBUF_PARAM_ERR;
+    size_t total = 0;
+    for (size_t i = 0; i < iovcnt; i++) {
+        if (iov[i].base == NULL && iov[i].len)
+            return RINGBUF_PARAM_ERR;
+        total += iov[i].len;
+    }
+    if (total > rb->size) {
+        RINGBUF_STAT_INC(rb, overflows);
+        return RINGBUF_OVERFLOW;
+    }
+    RINGBUF_STATUS pst = ringbuf_check_policy(rb, total);
+    if (pst != RINGBUF_OK)
+        return pst;
+    bool was_empty = (rb->head == rb->tail);
+    size_t head = rb->head;
+    size_t done = 0;
+    for (size_t i = 0; i < iovcnt; i++) {
+        size_t idx = head + done;
+        if (rb->mask)
+            idx &= rb->mask;
+        else if (idx >= rb->size)
+            idx -= rb->size;
+        ringbuf_copy_in(rb, idx, iov[i].base, iov[i].len);
+        done += iov[i].len;
+    }
+    // publish all the segments with one store of head
+    head += total;
+    if (!rb->mask && head >= rb->size)
+        head -= rb->size;
+    rb->head = head;
+    rb->put_total += total;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, was_empty && total);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Read into scattered segments in one transaction
+ * @note Fills the iovec list in order and publishes tail once at the
+ *       end; the combined length must be available or nothing is
+ *       consumed
+ *
+ * @param[in] iov Segments to fill, #RINGBUF_IOV_t array
+ * @param[in] iovcnt Number of segments
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR if not enough data
+ */
+RINGBUF_STATUS RingBuf_DataReadV(const RINGBUF_IOV_t *iov, size_t iovcnt, RINGBUF_t *rb) {
+    if (rb->buf == NULL || iov == NULL)
+        return RINGBUF_PARAM_ERR;
+    size_t total = 0;
+    for (size_t i = 0; i < iovcnt; i++) {
+        if (iov[i].base == NULL && iov[i].len)
+            return RINGBUF_PARAM_ERR;
+        total += iov[i].len;
+    }
+    size_t avail = 0;
+    RingBuf_AvailableEx(&avail, rb);
+    if (total > avail)
+        return RINGBUF_ERR;
+    size_t tail = rb->tail;
+    size_t done = 0;
+    for (size_t i = 0; i < iovcnt; i++) {
+        size_t idx = tail + done;
+        if (rb->mask)
+            idx &= rb->mask;
+        else if (idx >= rb->size)
+            idx -= rb->size;
+        ringbuf_copy_out(rb, idx, iov[i].base, iov[i].len);
+        done += iov[i].len;
+    }
+    // flush all the segments with one store of tail
+    tail += total;
+    if (!rb->mask && tail >= rb->size)
+        tail -= rb->size;
+    rb->tail = tail;
+    rb->read_total += total;
+    RINGBUF_STAT_INC(rb, reads);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Init ring buffer over a hardware-written region
+ * @note DMA adapter mode: the region the DMA engine fills circularly
+ *       becomes the ring storage itself, removing the per-byte ISR
+ *       copy. The hardware owns head; the ISR translates the write
+ *       position (e.g. size - NDTR on STM32) and publishes it with
+ *       #RingBuf_UpdateHead. All read/watch/segment calls work
+ *       unmodified; the put calls must not be used. Classic wrapping
+ *       is forced, since hardware positions are already wrapped
+ *       indices in [0, size)
+ *
+ * @param[in] buf Pointer to the DMA target region
+ * @param[in] size Size of buffer [cells]
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_InitExternalHead(void *buf, size_t size, size_t cellsize, RINGBUF_t *rb) {
+    RINGBUF_STATUS st = RingBuf_InitEx(buf, size, cellsize, rb);
+    if (st != RINGBUF_OK)
+        return st;
+    rb->ext_head = 1;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Publish the hardware write position
+ * @note Call from the ISR (or a poll loop) with the current hardware
+ *       cell index; one store, ISR-safe like the other index
+ *       publishes. Consumed-vs-produced accounting derives the cell
+ *       count from the index delta. Overrun detection is up to the
+ *       caller: the hardware does not stop at tail
+ *
+ * @param[in] new_head Hardware write position [cells], in [0, size)
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_UpdateHead(size_t new_head, RINGBUF_t *rb) {
+    if (rb->buf == NULL || !rb->ext_head)
+        return RINGBUF_PARAM_ERR;
+    if (new_head >= rb->size)
+        return RINGBUF_PARAM_ERR;
+    size_t old = rb->head;
+    if (new_head == old)
+        return RINGBUF_OK;
+    bool was_empty = (old == rb->tail);
+    rb->head = new_head; // single store, matches the put paths
+    size_t delta = (new_head > old) ? new_head - old
+                                    : rb->size - old + new_head;
+    rb->put_total += delta;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, was_empty);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Move the ring to a new buffer without dropping unread data
+ * @note Online resize: the unread region is relocated to the start of
+ *       new_buf (at most two copies, the same wrap logic as the watch
+ *       path) and the instance is switched over with tail 0 and head
+ *       at the fill level. Grow during a burst, shrink back after —
+ *       the old buffer is the caller's to free. Power-of-two rings
+ *       stay power-of-two: a non-pow2 new_size is rejected there. The
+ *       swap rewrites buf/size/head/tail together, so the caller must
+ *       hold both sides quiescent for the call; in an SPSC pipeline
+ *       run it on the producer with the consumer paused. Mirrored,
+ *       file-backed and external-head rings own their storage and are
+ *       refused
+ *
+ * @param[in] new_buf Pointer to the new allocated buffer
+ * @param[in] new_size Size of the new buffer [cells]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_OVERFLOW if the unread data does not fit
+ */
+RINGBUF_STATUS RingBuf_Migrate(void *new_buf, size_t new_size, RINGBUF_t *rb) {
+    if (rb->buf == NULL || new_buf == NULL || new_size == 0)
+        return RINGBUF_PARAM_ERR;
+    if (rb->mirror || rb->mapped || rb->ext_head)
+        return RINGBUF_PARAM_ERR; // storage is owned by the mode, not the caller
+    if (rb->mask && (new_size & (new_size - 1)) != 0)
+        return RINGBUF_PARAM_ERR; // pow2 rings stay pow2
+    size_t avail = 0;
+    RingBuf_AvailableEx(&avail, rb);
+    // classic mode keeps one cell free, as everywhere else
+    size_t cap = rb->mask ? new_size : new_size - 1;
+    if (avail > cap)
+        return RINGBUF_OVERFLOW;
+    // relocate the unread region to the start of the new buffer
+    ringbuf_copy_out(rb, rb->mask ? (rb->tail & rb->mask) : rb->tail, new_buf, avail);
+    rb->buf = new_buf;
+    rb->size = new_size;
+    if (rb->mask)
+        rb->mask = new_size - 1;
+    rb->tail = 0;
+    rb->head = avail;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Attach a parallel timestamp array to the ring
+ * @note The array holds one u64_t per cell (size entries) and is
+ *       filled by #RingBuf_CellPutTs. Timestamps must be put in
+ *       monotonic non-decreasing order for #RingBuf_EvictOlderThan
+ *       to search over them
+ *
+ * @param[in] ts Timestamp array, one entry per cell
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_AttachTs(u64_t *ts, RINGBUF_t *rb) {
+    if (rb->buf == NULL || ts == NULL) return RINGBUF_PARAM_ERR;
+    rb->ts = ts;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Put 1 cell to the buffer with its timestamp
+ * @note Like #RingBuf_CellPut, plus the timestamp lands in the
+ *       parallel array before the head publish, so a visible cell
+ *       always has a valid timestamp
+ *
+ * @param[in] data Pointer to data
+ * @param[in] ts Cell timestamp, monotonic units of the caller's choice
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_CellPutTs(const void *data, u64_t ts, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL || rb->ts == NULL)
+        return RINGBUF_PARAM_ERR;
+    RINGBUF_STATUS pst = ringbuf_check_policy(rb, 1);
+    if (pst != RINGBUF_OK)
+        return pst;
+    bool was_empty = (rb->head == rb->tail);
+    size_t head = rb->head;
+    size_t idx = rb->mask ? (head & rb->mask) : head;
+    memcpy(&rb->buf[idx * rb->cell_size], data, rb->cell_size);
+    rb->ts[idx] = ts;
+    // publish the new head with a single store
+    head++;
+    if (!rb->mask && head >= rb->size)
+        head = 0;
+    rb->head = head;
+    rb->put_total++;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, was_empty);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Watch 1 cell and its timestamp without flushing
+ *
+ * @param[out] data Data cell from the buffer
+ * @param[out] ts Timestamp of the cell
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR when the buffer is empty
+ */
+RINGBUF_STATUS RingBuf_CellWatchTs(void *data, u64_t *ts, RINGBUF_t *rb) {
+    if (rb->buf == NULL || data == NULL || ts == NULL || rb->ts == NULL)
+        return RINGBUF_PARAM_ERR;
+    if (rb->head == rb->tail)
+        return RINGBUF_ERR;
+    size_t idx = rb->mask ? (rb->tail & rb->mask) : rb->tail;
+    memcpy(data, &rb->buf[idx * rb->cell_size], rb->cell_size);
+    *ts = rb->ts[idx];
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Drop every buffered cell with a timestamp below the cutoff
+ * @note Binary search over the monotonic timestamps finds the first
+ *       fresh cell, then one tail store flushes all the stale ones:
+ *       O(log n) instead of reading and discarding cell by cell.
+ *       Cells with ts == cutoff are kept
+ *
+ * @param[in] cutoff Eviction cutoff, same units as the put timestamps
+ * @param[out] evicted Number of cells dropped, may be NULL
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_EvictOlderThan(u64_t cutoff, size_t *evicted, RINGBUF_t *rb) {
+    if (rb->buf == NULL || rb->ts == NULL)
+        return RINGBUF_PARAM_ERR;
+    size_t avail = 0;
+    RingBuf_AvailableEx(&avail, rb);
+    size_t tail = rb->tail;
+    // first offset from tail whose timestamp reaches the cutoff
+    size_t lo = 0, hi = avail;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        size_t idx = tail + mid;
+        if (rb->mask)
+            idx &= rb->mask;
+        else if (idx >= rb->size)
+            idx -= rb->size;
+        if (rb->ts[idx] < cutoff)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (evicted)
+        *evicted = lo;
+    if (lo == 0)
+        return RINGBUF_OK;
+    // flush all the stale cells with one store of tail
+    tail += lo;
+    if (!rb->mask && tail >= rb->size)
+        tail -= rb->size;
+    rb->tail = tail;
+    rb->read_total += lo;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Publish a write batch with one store of head
+ * @note Adds the batched cell count to the lifetime totals, so the
+ *       produced - consumed == fill invariant of #RingBuf_Stats holds
+ *       for rings fed through cursors too. Also raises the group
+ *       readiness bit on the empty-to-non-empty transition, like the
+ *       plain puts, so grouped rings may be fed through the batch API
+ *
+ * @param[in] cur Cursor from #RingBuf_BatchBegin
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_BatchCommit(RINGBUF_CURSOR_t *cur) {
+    if (cur == NULL || cur->rb == NULL) return RINGBUF_PARAM_ERR;
+    RINGBUF_t *rb = cur->rb;
+    bool was_empty = (rb->head == rb->tail);
+    rb->head = cur->pos;
+    rb->put_total += cur->count;
+    RINGBUF_STAT_PUT(rb);
+    ringbuf_group_notify(rb, was_empty && cur->count);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Flush a read batch with one store of tail
+ * @note Adds the batched cell count to the lifetime totals, like
+ *       #RingBuf_BatchCommit on the write side
+ *
+ * @param[in] cur Cursor from #RingBuf_BatchReadBegin
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_BatchReadCommit(RINGBUF_CURSOR_t *cur) {
+    if (cur == NULL || cur->rb == NULL) return RINGBUF_PARAM_ERR;
+    RINGBUF_t *rb = cur->rb;
+    rb->tail = cur->pos;
+    rb->read_total += cur->count;
+    RINGBUF_STAT_INC(rb, reads);
     return RINGBUF_OK;
 }
 
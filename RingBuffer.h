@@ -23,6 +23,65 @@ extern "C" {
  * @{
  */
 
+/**
+ * @enum RINGBUF_POLICY
+ * @brief Overflow policy applied by the put functions when the buffer is full
+ */
+typedef enum RINGBUF_POLICY{
+    RINGBUF_POLICY_UNCHECKED,        ///< No fill check: fastest, may overrun unread data
+    RINGBUF_POLICY_OVERWRITE_OLDEST, ///< Advance tail to make room, oldest data is lost
+    RINGBUF_POLICY_DROP_NEWEST,      ///< Return #RINGBUF_OVERFLOW without writing
+} RINGBUF_POLICY;
+
+/**
+ * @enum RINGBUF_WAIT
+ * @brief Waiting strategy used by the blocking variants when the ring
+ *        is full/empty, declared per instance at init time
+ */
+typedef enum RINGBUF_WAIT{
+    RINGBUF_WAIT_SLEEP_BACKOFF,  ///< Spin, then yield, then exponential naps (default)
+    RINGBUF_WAIT_SPIN,           ///< Pure busy spin: lowest latency, burns the core
+    RINGBUF_WAIT_SPIN_THEN_YIELD, ///< Spin briefly, then sched_yield, never sleeps
+    RINGBUF_WAIT_CALLBACK,       ///< User hook, see #RINGBUF_WAIT_FN (e.g. WFE/WFI)
+} RINGBUF_WAIT;
+
+/**
+ * @brief User wait hook for #RINGBUF_WAIT_CALLBACK
+ * @note Called once per failed attempt; add the time spent waiting to
+ *       *elapsed_us so the timeouts keep working
+ *
+ * @param[in] round Attempt counter, starts at 0
+ * @param[in,out] elapsed_us Accumulated waiting time [us]
+ * @param[in] arg User argument from #RingBuf_SetWaitCallback
+ */
+typedef void (*RINGBUF_WAIT_FN)(u32_t round, u64_t *elapsed_us, void *arg);
+
+#ifdef RINGBUF_STATS
+
+/// Fill-level histogram buckets, bucket i covers [i, i+1)/8 of size
+#define RINGBUF_STATS_BUCKETS 8u
+/// A fill sample is taken every 2^shift put operations
+#define RINGBUF_STATS_SAMPLE_SHIFT 6u
+
+/**
+ * @struct RINGBUF_COUNTERS_t
+ * @brief Instrumentation counters, compiled in with RINGBUF_STATS
+ * @note Updates are plain unsynchronized increments on the owning
+ *       side, a couple of cycles per operation; snapshots taken while
+ *       the ring is hot may be slightly torn, which is fine for
+ *       monitoring
+ */
+typedef struct RINGBUF_COUNTERS_t{
+    u64_t puts;      ///< Put operations that wrote data
+    u64_t reads;     ///< Read operations that consumed data
+    u64_t overflows; ///< Put attempts rejected with #RINGBUF_OVERFLOW
+    u64_t wraps;     ///< Put operations that crossed the wrap point
+    u64_t max_fill;  ///< Highest fill level observed after a put [cells]
+    u64_t fill_hist[RINGBUF_STATS_BUCKETS]; ///< Sampled fill-level histogram
+} RINGBUF_COUNTERS_t;
+
+#endif /* RINGBUF_STATS */
+
 /**
  * @struct RINGBUF_t
  * @brief Ring buffer unit
@@ -33,8 +92,33 @@ typedef struct RINGBUF_t{
     volatile size_t head; ///< Place of write point [cells]
     volatile size_t size; ///< Size of buffer [cells]
     volatile size_t cell_size; ///< Size of one cell [bytes]
+    size_t mask;          ///< Index mask in power-of-two mode, 0 in classic mode
+    RINGBUF_POLICY policy; ///< Overflow policy, #RINGBUF_POLICY_UNCHECKED by default
+    u8_t mirror;          ///< Storage is mapped twice back-to-back (mirrored mode)
+    u8_t mapped;          ///< Storage is a mapped file (persistent mode)
+    u8_t ext_head;        ///< Head is published by hardware (DMA adapter mode)
+    struct RINGBUF_GROUP_t *group; ///< Group this ring is registered in, or NULL
+    u8_t group_bit;       ///< Readiness bit index within the group
+    u64_t put_total;      ///< Lifetime cells produced
+    u64_t read_total;     ///< Lifetime cells consumed (reads, skips, evictions)
+    u64_t *ts;            ///< Parallel per-cell timestamps, or NULL (see #RingBuf_AttachTs)
+    RINGBUF_WAIT wait;    ///< Waiting strategy, #RINGBUF_WAIT_SLEEP_BACKOFF by default
+    RINGBUF_WAIT_FN wait_fn; ///< User wait hook for #RINGBUF_WAIT_CALLBACK
+    void *wait_arg;       ///< User argument passed to the wait hook
+#ifdef RINGBUF_STATS
+    RINGBUF_COUNTERS_t stats; ///< Instrumentation counters
+#endif
 } RINGBUF_t;
 
+/**
+ * @struct RINGBUF_STATS_t
+ * @brief Lifetime statistics snapshot, see #RingBuf_Stats
+ */
+typedef struct RINGBUF_STATS_t{
+    u64_t produced; ///< Total cells ever put
+    u64_t consumed; ///< Total cells ever read, skipped or evicted
+} RINGBUF_STATS_t;
+
 /**
  * @enum RINGBUF_STATUS
  * @brief Ring buf status enum
@@ -47,26 +131,165 @@ typedef enum RINGBUF_STATUS{
     RINGBUF_ERR,      ///< Error
     RINGBUF_PARAM_ERR, ///< Parameter error
     RINGBUF_OVERFLOW, ///< Buffer overflow
+    RINGBUF_TIMEOUT,  ///< Wait timed out
 } RINGBUF_STATUS;
 
+/// Wait forever in the blocking put/read variants
+#define RINGBUF_WAIT_FOREVER 0xFFFFFFFFu
+
+/**
+ * @struct RINGBUF_CURSOR_t
+ * @brief Local cursor for batched cell access
+ *
+ * Opened with #RingBuf_BatchBegin or #RingBuf_BatchReadBegin; the
+ * per-cell calls advance only this struct (no stores to the shared
+ * ring indices) and the commit publishes head or tail once for the
+ * whole batch.
+ */
+typedef struct RINGBUF_CURSOR_t{
+    RINGBUF_t *rb; ///< Ring the cursor was opened on
+    size_t pos;    ///< Local copy of head (write) or tail (read) [cells]
+    size_t count;  ///< Cells moved through the cursor since begin [cells]
+} RINGBUF_CURSOR_t;
+
+/**
+ * @struct RINGBUF_IOV_t
+ * @brief One segment of a scatter-gather transfer
+ * @note Field-for-field the POSIX struct iovec layout, so network
+ *       code can cast its iovec arrays instead of repacking; len is
+ *       counted in cells, which coincide for byte rings
+ */
+typedef struct RINGBUF_IOV_t{
+    void *base; ///< Segment data
+    size_t len; ///< Segment length [cells]
+} RINGBUF_IOV_t;
+
 RINGBUF_STATUS RingBuf_Init(void *buf, u16_t size, size_t cellsize, RINGBUF_t *rb); // Init buf
+RINGBUF_STATUS RingBuf_InitPow2(void *buf, u16_t size, size_t cellsize, RINGBUF_t *rb); // Init buf, size must be 2^n
 RINGBUF_STATUS RingBuf_Clear(RINGBUF_t *rb);			 	 // Clear buf
+RINGBUF_STATUS RingBuf_SetPolicy(RINGBUF_POLICY policy, RINGBUF_t *rb); // Set overflow policy
+RINGBUF_STATUS RingBuf_SetWait(RINGBUF_WAIT wait, RINGBUF_t *rb); // Set waiting strategy
+RINGBUF_STATUS RingBuf_SetWaitCallback(RINGBUF_WAIT_FN fn, void *arg, RINGBUF_t *rb); // Set user wait hook
+RINGBUF_STATUS RingBuf_Stats(RINGBUF_STATS_t *stats, RINGBUF_t *rb); // Lifetime produced/consumed counts
+RINGBUF_STATUS RingBuf_Migrate(void *new_buf, size_t new_size, RINGBUF_t *rb); // Move to a new buffer, keeping unread data
+
+// Ts: timestamped cells for latency-bounded queues
+RINGBUF_STATUS RingBuf_AttachTs(u64_t *ts, RINGBUF_t *rb); // Attach a parallel timestamp array
+RINGBUF_STATUS RingBuf_CellPutTs(const void *data, u64_t ts, RINGBUF_t *rb); // Put 1 cell with its timestamp
+RINGBUF_STATUS RingBuf_CellWatchTs(void *data, u64_t *ts, RINGBUF_t *rb); // Watch 1 cell and its timestamp
+RINGBUF_STATUS RingBuf_EvictOlderThan(u64_t cutoff, size_t *evicted, RINGBUF_t *rb); // Drop all stale cells at once
+#ifdef RINGBUF_STATS
+RINGBUF_STATUS RingBuf_GetStats(RINGBUF_COUNTERS_t *out, RINGBUF_t *rb); // Snapshot instrumentation counters
+RINGBUF_STATUS RingBuf_ResetStats(RINGBUF_t *rb); // Zero instrumentation counters
+#endif
+
+// External head: hardware-producer (DMA) adapter mode
+RINGBUF_STATUS RingBuf_InitExternalHead(void *buf, size_t size, size_t cellsize, RINGBUF_t *rb); // Init over a DMA region
+RINGBUF_STATUS RingBuf_UpdateHead(size_t new_head, RINGBUF_t *rb); // Publish the hardware write position
+
+// Ex: full-width variants, not capped at 64K cells
+RINGBUF_STATUS RingBuf_InitEx(void *buf, size_t size, size_t cellsize, RINGBUF_t *rb); // Init buf
+RINGBUF_STATUS RingBuf_InitPow2Ex(void *buf, size_t size, size_t cellsize, RINGBUF_t *rb); // Init buf, size must be 2^n
+RINGBUF_STATUS RingBuf_AvailableEx(size_t *len, RINGBUF_t *rb); // Data available
+RINGBUF_STATUS RingBuf_DataPutEx(const void *data, size_t len, RINGBUF_t *rb); // Put data to the buf
+RINGBUF_STATUS RingBuf_DataReadEx(void *data, size_t len, RINGBUF_t *rb); // Read data from buf
+RINGBUF_STATUS RingBuf_DataWatchEx(void *data, size_t len, RINGBUF_t *rb); // Watch data from buf
 RINGBUF_STATUS RingBuf_Available(u16_t *len, RINGBUF_t *rb); // Data available
 
 // Put: add data to buffer
 RINGBUF_STATUS RingBuf_BytePut(const u8_t data, RINGBUF_t *rb); // Put byte to the buf
 RINGBUF_STATUS RingBuf_CellPut(const void *data, RINGBUF_t *rb); // Put 1 cell to the buf
 RINGBUF_STATUS RingBuf_DataPut(const void *data, u16_t len, RINGBUF_t *rb); // Put data to the buf
+RINGBUF_STATUS RingBuf_DataPutUpTo(const void *data, u16_t len, u16_t *actual, RINGBUF_t *rb); // Put as much as fits
+RINGBUF_STATUS RingBuf_DataPutV(const RINGBUF_IOV_t *iov, size_t iovcnt, RINGBUF_t *rb); // Put scattered segments
 
 // Read: Get data & flush it
 RINGBUF_STATUS RingBuf_ByteRead(u8_t *data, RINGBUF_t *rb); // Read byte from buf
 RINGBUF_STATUS RingBuf_CellRead(void *data, RINGBUF_t *rb); // Read 1 cell from buf
 RINGBUF_STATUS RingBuf_DataRead(void *data, u16_t len, RINGBUF_t *rb); // Read data from buf
+RINGBUF_STATUS RingBuf_DataReadUpTo(void *data, u16_t max_len, u16_t *actual, RINGBUF_t *rb); // Read what is there
+RINGBUF_STATUS RingBuf_DataReadV(const RINGBUF_IOV_t *iov, size_t iovcnt, RINGBUF_t *rb); // Read into scattered segments
+
+// Wait: blocking put/read for thread pipelines (spin, then back off)
+RINGBUF_STATUS RingBuf_DataPutWait(const void *data, u16_t len, u32_t timeout_ms, RINGBUF_t *rb); // Put, waiting for space
+RINGBUF_STATUS RingBuf_DataReadWait(void *data, u16_t len, u32_t timeout_ms, RINGBUF_t *rb); // Read, waiting for data
+RINGBUF_STATUS RingBuf_WaitNotEmpty(u32_t timeout_ms, RINGBUF_t *rb); // Wait until data is available
+RINGBUF_STATUS RingBuf_WaitNotFull(u32_t timeout_ms, RINGBUF_t *rb); // Wait until a cell fits
+
+// Batch: amortize the index publish over many cells.
+// No fill checking: the caller ensures the batch fits, as with the
+// unchecked puts. Inline so a drain loop keeps the cursor in registers.
+
+/// Open a write cursor at the current head
+static inline RINGBUF_STATUS RingBuf_BatchBegin(RINGBUF_t *rb, RINGBUF_CURSOR_t *cur) {
+    if (rb->buf == NULL || cur == NULL) return RINGBUF_PARAM_ERR;
+    cur->rb = rb;
+    cur->pos = rb->head;
+    cur->count = 0;
+    return RINGBUF_OK;
+}
+
+/// Put 1 cell through the cursor; nothing is visible until commit
+static inline void RingBuf_BatchPutCell(RINGBUF_CURSOR_t *cur, const void *data) {
+    RINGBUF_t *rb = cur->rb;
+    size_t idx = rb->mask ? (cur->pos & rb->mask) : cur->pos;
+    memcpy(&rb->buf[idx * rb->cell_size], data, rb->cell_size);
+    cur->pos++;
+    cur->count++;
+    if (!rb->mask && cur->pos >= rb->size)
+        cur->pos = 0;
+}
+
+// Publish the whole batch with one store of head. Out of line: the
+// commit runs once per batch and maintains the lifetime totals and
+// group readiness, only the per-cell calls above need to inline.
+RINGBUF_STATUS RingBuf_BatchCommit(RINGBUF_CURSOR_t *cur);
+
+/// Open a read cursor at the current tail
+static inline RINGBUF_STATUS RingBuf_BatchReadBegin(RINGBUF_t *rb, RINGBUF_CURSOR_t *cur) {
+    if (rb->buf == NULL || cur == NULL) return RINGBUF_PARAM_ERR;
+    cur->rb = rb;
+    cur->pos = rb->tail;
+    cur->count = 0;
+    return RINGBUF_OK;
+}
+
+/// Read 1 cell through the cursor; nothing is flushed until commit
+static inline void RingBuf_BatchReadCell(RINGBUF_CURSOR_t *cur, void *data) {
+    RINGBUF_t *rb = cur->rb;
+    size_t idx = rb->mask ? (cur->pos & rb->mask) : cur->pos;
+    memcpy(data, &rb->buf[idx * rb->cell_size], rb->cell_size);
+    cur->pos++;
+    cur->count++;
+    if (!rb->mask && cur->pos >= rb->size)
+        cur->pos = 0;
+}
+
+// Flush the whole batch with one store of tail (out of line, see
+// RingBuf_BatchCommit)
+RINGBUF_STATUS RingBuf_BatchReadCommit(RINGBUF_CURSOR_t *cur);
+
+// Claim/Commit: zero-copy access to the ring storage
+RINGBUF_STATUS RingBuf_WriteClaim(u16_t len, u8_t **ptr, u16_t *contig_len, RINGBUF_t *rb); // Claim write region
+RINGBUF_STATUS RingBuf_WriteCommit(u16_t len, RINGBUF_t *rb); // Commit claimed write
+RINGBUF_STATUS RingBuf_ReadClaim(u16_t len, u8_t **ptr, u16_t *contig_len, RINGBUF_t *rb); // Claim read region
+RINGBUF_STATUS RingBuf_ReadCommit(u16_t len, RINGBUF_t *rb); // Commit claimed read
+
+// Segments: batched zero-copy draining
+RINGBUF_STATUS RingBuf_GetReadSegments(u8_t **seg1, u16_t *len1, u8_t **seg2, u16_t *len2, RINGBUF_t *rb); // Readable regions
+RINGBUF_STATUS RingBuf_Skip(u16_t len, RINGBUF_t *rb); // Flush data without reading
+
+// Msg: length-framed messages on byte rings (cell_size 1)
+RINGBUF_STATUS RingBuf_MsgPut(const void *data, u16_t len, RINGBUF_t *rb); // Put one framed message
+RINGBUF_STATUS RingBuf_MsgPeekLen(u16_t *len, RINGBUF_t *rb); // Payload length of the next frame
+RINGBUF_STATUS RingBuf_MsgRead(void *data, u16_t max, u16_t *len, RINGBUF_t *rb); // Read one framed message
 
 // Watch: Get data without flushing
 RINGBUF_STATUS RingBuf_ByteWatch(u8_t *data, RINGBUF_t *rb); // Watch byte from buf
 RINGBUF_STATUS RingBuf_CellWatch(void *data, RINGBUF_t *rb); // Watch 1 cell from buf
 RINGBUF_STATUS RingBuf_DataWatch(void *data, u16_t len, RINGBUF_t *rb); // Watch data form buf
+RINGBUF_STATUS RingBuf_ByteWatchAt(u16_t offset, u8_t *data, RINGBUF_t *rb); // Watch byte at offset from tail
+RINGBUF_STATUS RingBuf_WatchAt(u16_t offset, void *data, u16_t len, RINGBUF_t *rb); // Watch data at offset from tail
 
 /// @} RING_BUF Group
 
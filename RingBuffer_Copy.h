@@ -0,0 +1,95 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Copy.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Internal copy kernel for RingBuffer lib
+ * @note    Included by the RingBuffer translation units only,
+ *          not part of the public API
+ *******************************************
+ */
+#ifndef RING_BUF_COPY_H_
+#define RING_BUF_COPY_H_
+
+#include "libs.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @addtogroup RING_BUF_COPY
+ * @brief Alignment-aware copy dispatch for the ring data paths
+ *
+ * Small and medium transfers go straight to memcpy, which libc already
+ * vectorizes well. Transfers at or above RINGBUF_NT_THRESHOLD bytes
+ * are streamed with non-temporal stores (AVX2 or SSE2 when the build
+ * targets them) so bulk audio/DMA traffic through the ring stops
+ * evicting the consumer's working set from cache. Other targets
+ * (NEON included) fall back to memcpy, whose libc implementation
+ * already saturates those cores.
+ * @{
+ */
+
+#ifndef RINGBUF_NT_THRESHOLD
+#define RINGBUF_NT_THRESHOLD (1024u * 1024u) ///< Stream copies at/above this size [bytes]
+#endif
+
+#if defined(__AVX2__)
+
+/// Non-temporal bulk copy, 32-byte stores, dst aligned by the caller path
+static inline void ringbuf_copy_stream(u8_t *dst, const u8_t *src, size_t n) {
+    // align dst to the store width, memcpy the ragged head
+    size_t lead = (32 - ((uintptr_t)dst & 31)) & 31;
+    if (lead) {
+        memcpy(dst, src, lead);
+        dst += lead; src += lead; n -= lead;
+    }
+    while (n >= 32) {
+        _mm256_stream_si256((__m256i *)dst, _mm256_loadu_si256((const __m256i *)src));
+        dst += 32; src += 32; n -= 32;
+    }
+    _mm_sfence(); // make the streamed data globally visible
+    if (n)
+        memcpy(dst, src, n);
+}
+
+#elif defined(__SSE2__)
+
+/// Non-temporal bulk copy, 16-byte stores, dst aligned by the caller path
+static inline void ringbuf_copy_stream(u8_t *dst, const u8_t *src, size_t n) {
+    size_t lead = (16 - ((uintptr_t)dst & 15)) & 15;
+    if (lead) {
+        memcpy(dst, src, lead);
+        dst += lead; src += lead; n -= lead;
+    }
+    while (n >= 16) {
+        _mm_stream_si128((__m128i *)dst, _mm_loadu_si128((const __m128i *)src));
+        dst += 16; src += 16; n -= 16;
+    }
+    _mm_sfence(); // make the streamed data globally visible
+    if (n)
+        memcpy(dst, src, n);
+}
+
+#endif
+
+/**
+ * @brief Copy dispatch used by the ring data paths
+ * @note Drop-in for memcpy; picks the streaming kernel for transfers
+ *       that would otherwise blow out the cache
+ */
+static inline void ringbuf_copy(void *dst, const void *src, size_t n) {
+#if defined(__AVX2__) || defined(__SSE2__)
+    if (n >= RINGBUF_NT_THRESHOLD) {
+        ringbuf_copy_stream(dst, src, n);
+        return;
+    }
+#endif
+    memcpy(dst, src, n);
+}
+
+/// @} RING_BUF_COPY Group
+
+#endif /* RING_BUF_COPY_H_ */
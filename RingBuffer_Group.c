@@ -0,0 +1,98 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Group.c
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Source file for RingBuffer ring groups (fan-in dispatch)
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+
+#include "RingBuffer_Group.h"
+
+/**
+ * @addtogroup RING_BUF_GROUP
+ * @{
+ */
+
+/**
+ * @brief Init empty ring group
+ *
+ * @param[in] group #RINGBUF_GROUP_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBufGroup_Init(RINGBUF_GROUP_t *group) {
+    if (group == NULL) return RINGBUF_PARAM_ERR;
+    atomic_init(&group->ready, 0);
+    for (size_t i = 0; i < RINGBUF_GROUP_MAX; i++)
+        group->rings[i] = NULL;
+    group->count = 0;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Register a ring into the group
+ * @note Call before any producer is active on the ring; the put paths
+ *       start setting the readiness bit from the next empty-to-non-empty
+ *       transition on
+ *
+ * @param[in] group #RINGBUF_GROUP_t structure instance
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_OVERFLOW when the group is full
+ */
+RINGBUF_STATUS RingBufGroup_Add(RINGBUF_GROUP_t *group, RINGBUF_t *rb) {
+    if (group == NULL || rb == NULL || rb->buf == NULL)
+        return RINGBUF_PARAM_ERR;
+    if (group->count >= RINGBUF_GROUP_MAX)
+        return RINGBUF_OVERFLOW;
+    rb->group_bit = group->count;
+    rb->group = group;
+    group->rings[group->count++] = rb;
+    // data may already be waiting in the ring
+    if (rb->head != rb->tail)
+        atomic_fetch_or_explicit(&group->ready, 1ull << rb->group_bit, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Claim a ready ring with one bit-scan
+ * @note Clears the ring's readiness bit: drain it, then call
+ *       #RingBufGroup_Done so leftover data re-arms the bit
+ *
+ * @param[in] group #RINGBUF_GROUP_t structure instance
+ * @param[out] rb Ready ring
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR when no ring is ready
+ */
+RINGBUF_STATUS RingBufGroup_Next(RINGBUF_GROUP_t *group, RINGBUF_t **rb) {
+    if (group == NULL || rb == NULL) return RINGBUF_PARAM_ERR;
+    for (;;) {
+        u64_t ready = atomic_load_explicit(&group->ready, memory_order_acquire);
+        if (ready == 0)
+            return RINGBUF_ERR;
+        u8_t bit = (u8_t)__builtin_ctzll(ready);
+        // claim the bit; another consumer may have beaten us to it
+        u64_t prev = atomic_fetch_and_explicit(&group->ready, ~(1ull << bit), memory_order_acq_rel);
+        if (prev & (1ull << bit)) {
+            *rb = group->rings[bit];
+            return RINGBUF_OK;
+        }
+    }
+}
+
+/**
+ * @brief Finish a claim from #RingBufGroup_Next
+ * @note Re-arms the readiness bit when the consumer left data behind,
+ *       so partial drains are never lost
+ *
+ * @param[in] rb Ring obtained from #RingBufGroup_Next
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBufGroup_Done(RINGBUF_t *rb) {
+    if (rb == NULL || rb->group == NULL) return RINGBUF_PARAM_ERR;
+    if (rb->head != rb->tail)
+        atomic_fetch_or_explicit(&rb->group->ready, 1ull << rb->group_bit, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/// @} RING_BUF_GROUP Group
@@ -0,0 +1,64 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Group.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Header file for RingBuffer ring groups (fan-in dispatch)
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_GROUP_H_
+#define RING_BUF_GROUP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+
+#ifdef __STDC_NO_ATOMICS__
+#error "RingBuffer_Group requires C11 atomics"
+#endif
+
+#include <stdatomic.h>
+
+/**
+ * @addtogroup RING_BUF_GROUP
+ * @brief Multi-ring readiness dispatch for fan-in consumers
+ *
+ * Up to 64 rings register into a group. The put paths set the ring's
+ * readiness bit in one atomic word on the empty-to-non-empty
+ * transition, and #RingBufGroup_Next hands the consumer a ready ring
+ * with a single bit-scan instead of polling RingBuf_Available over
+ * every ring. Pattern: Next claims a ring (its bit is cleared), the
+ * consumer drains as much as it wants, then calls #RingBufGroup_Done,
+ * which re-arms the bit if data is still left.
+ * @{
+ */
+
+/// Maximum rings per group (bits in the readiness word)
+#define RINGBUF_GROUP_MAX 64u
+
+/**
+ * @struct RINGBUF_GROUP_t
+ * @brief Group of rings sharing one readiness word
+ */
+typedef struct RINGBUF_GROUP_t{
+    atomic_uint_fast64_t ready;          ///< One readiness bit per registered ring
+    RINGBUF_t *rings[RINGBUF_GROUP_MAX]; ///< Registered rings by bit index
+    u8_t count;                          ///< Number of registered rings
+} RINGBUF_GROUP_t;
+
+RINGBUF_STATUS RingBufGroup_Init(RINGBUF_GROUP_t *group); // Init empty group
+RINGBUF_STATUS RingBufGroup_Add(RINGBUF_GROUP_t *group, RINGBUF_t *rb); // Register a ring
+RINGBUF_STATUS RingBufGroup_Next(RINGBUF_GROUP_t *group, RINGBUF_t **rb); // Claim a ready ring
+RINGBUF_STATUS RingBufGroup_Done(RINGBUF_t *rb); // Re-arm after draining
+
+/// @} RING_BUF_GROUP Group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_GROUP_H_ */
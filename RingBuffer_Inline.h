@@ -0,0 +1,97 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Inline.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Header-only fast path for single-byte/cell operations
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_INLINE_H_
+#define RING_BUF_INLINE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+
+/**
+ * @addtogroup RING_BUF_INLINE
+ * @brief Inline fast path for the hottest single-element operations
+ *
+ * The out-of-line byte and single-cell calls cost a function call, a
+ * NULL check and a reload of the ring fields per element. The
+ * _Fast variants below are static inline and skip the NULL check and
+ * overflow policy, so a byte-oriented drain loop inlines completely
+ * and the compiler keeps head/tail and the invariant fields in
+ * registers. Use them where the ring is known to be initialized and
+ * fill checking is done by the caller; keep the out-of-line versions
+ * where code size matters more than cycles.
+ * @{
+ */
+
+/// Put byte to the buf, no NULL check, no overflow policy
+static inline RINGBUF_STATUS RingBuf_BytePut_Fast(const u8_t data, RINGBUF_t *rb) {
+    if (rb->mask) {
+        rb->buf[rb->head++ & rb->mask] = data;
+        return RINGBUF_OK;
+    }
+    rb->buf[rb->head] = data;
+    rb->head = (rb->head + 1 >= rb->size) ? 0 : rb->head + 1;
+    return RINGBUF_OK;
+}
+
+/// Watch byte from buf, no NULL check
+static inline RINGBUF_STATUS RingBuf_ByteWatch_Fast(u8_t *data, RINGBUF_t *rb) {
+    *data = rb->buf[rb->mask ? (rb->tail & rb->mask) : rb->tail];
+    return RINGBUF_OK;
+}
+
+/// Read byte from buf, no NULL check
+static inline RINGBUF_STATUS RingBuf_ByteRead_Fast(u8_t *data, RINGBUF_t *rb) {
+    size_t tail = rb->tail;
+    *data = rb->buf[rb->mask ? (tail & rb->mask) : tail];
+    tail++;
+    if (!rb->mask && tail >= rb->size)
+        tail = 0;
+    rb->tail = tail;
+    return RINGBUF_OK;
+}
+
+/// Put 1 cell to the buf, no NULL check, no overflow policy
+static inline RINGBUF_STATUS RingBuf_CellPut_Fast(const void *data, RINGBUF_t *rb) {
+    size_t idx = rb->mask ? (rb->head & rb->mask) : rb->head;
+    memcpy(&rb->buf[idx * rb->cell_size], data, rb->cell_size);
+    size_t head = rb->head + 1;
+    if (!rb->mask && head >= rb->size)
+        head = 0;
+    rb->head = head;
+    return RINGBUF_OK;
+}
+
+/// Watch 1 cell from buf, no NULL check
+static inline RINGBUF_STATUS RingBuf_CellWatch_Fast(void *data, RINGBUF_t *rb) {
+    size_t idx = rb->mask ? (rb->tail & rb->mask) : rb->tail;
+    memcpy(data, &rb->buf[idx * rb->cell_size], rb->cell_size);
+    return RINGBUF_OK;
+}
+
+/// Read 1 cell from buf, no NULL check
+static inline RINGBUF_STATUS RingBuf_CellRead_Fast(void *data, RINGBUF_t *rb) {
+    RingBuf_CellWatch_Fast(data, rb);
+    size_t tail = rb->tail + 1;
+    if (!rb->mask && tail >= rb->size)
+        tail = 0;
+    rb->tail = tail;
+    return RINGBUF_OK;
+}
+
+/// @} RING_BUF_INLINE Group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_INLINE_H_ */
@@ -0,0 +1,142 @@
+/**
+ *******************************************
+ * @file    RingBuffer_MPMC.c
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Source file for lock-free MPMC RingBuffer
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+
+#include "RingBuffer_MPMC.h"
+
+/**
+ * @addtogroup RING_BUF_MPMC
+ * @{
+ */
+
+/**
+ * @brief Init MPMC ring buffer
+ *
+ * @param[in] buf Pointer to the allocated buffer
+ * @param[in] seq Pointer to the sequence array, one entry per cell
+ * @param[in] size Size of buffer [cells], must be a power of two
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[in] rb #RINGBUF_MPMC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_MPMC_Init(void *buf, atomic_size_t *seq, u16_t size, size_t cellsize, RINGBUF_MPMC_t *rb) {
+    if (buf == NULL || seq == NULL)
+        return RINGBUF_PARAM_ERR;
+    if (size == 0 || (size & (size - 1)) != 0) // not a power of two
+        return RINGBUF_PARAM_ERR;
+    rb->buf = buf;
+    rb->seq = seq;
+    rb->size = size;
+    rb->mask = (size_t)size - 1;
+    rb->cell_size = cellsize;
+    return RingBuf_MPMC_Clear(rb);
+}
+
+/**
+ * @brief Clear MPMC ring buffer
+ * @note Not thread-safe: call only when no producer or consumer is active
+ *
+ * @param[in] rb #RINGBUF_MPMC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_MPMC_Clear(RINGBUF_MPMC_t *rb) {
+    if (rb->buf == NULL || rb->seq == NULL) return RINGBUF_PARAM_ERR;
+    for (size_t i = 0; i < rb->size; i++)
+        atomic_store_explicit(&rb->seq[i], i, memory_order_relaxed);
+    atomic_store_explicit(&rb->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&rb->tail, 0, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Check available size to read
+ * @note Only an instantaneous approximation under concurrent use
+ *
+ * @param[out] len Cells available to read
+ * @param[in] rb #RINGBUF_MPMC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_MPMC_Available(u16_t *len, RINGBUF_MPMC_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    size_t head = atomic_load_explicit(&rb->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+    *len = (head > tail) ? (u16_t)(head - tail) : 0;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Put 1 cell to the buffer (any producer thread)
+ * @note CAS-claims a position on head, copies the cell, then publishes
+ *       it by advancing the cell's sequence with a release store
+ *
+ * @param[in] data Pointer to data
+ * @param[in] rb #RINGBUF_MPMC_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_OVERFLOW if the buffer is full
+ */
+RINGBUF_STATUS RingBuf_MPMC_CellPut(const void *data, RINGBUF_MPMC_t *rb) {
+    if (rb->buf == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    atomic_size_t *seq;
+    size_t pos = atomic_load_explicit(&rb->head, memory_order_relaxed);
+    for (;;) {
+        seq = &rb->seq[pos & rb->mask];
+        size_t s = atomic_load_explicit(seq, memory_order_acquire);
+        intptr_t dif = (intptr_t)s - (intptr_t)pos;
+        if (dif == 0) { // cell is free for this position: try to claim it
+            if (atomic_compare_exchange_weak_explicit(&rb->head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+            // pos reloaded by the failed CAS, retry
+        } else if (dif < 0) {
+            return RINGBUF_OVERFLOW; // consumer has not freed this cell yet
+        } else { // another producer claimed pos, reload
+            pos = atomic_load_explicit(&rb->head, memory_order_relaxed);
+        }
+    }
+    memcpy(&rb->buf[(pos & rb->mask) * rb->cell_size], data, rb->cell_size);
+    // publish: consumers wait for seq == pos + 1
+    atomic_store_explicit(seq, pos + 1, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Read 1 cell from the buffer (any consumer thread)
+ * @note CAS-claims a position on tail, copies the cell out, then frees
+ *       it for the next lap with a release store of the sequence
+ *
+ * @param[out] data Data cell from the buffer
+ * @param[in] rb #RINGBUF_MPMC_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR if the buffer is empty
+ */
+RINGBUF_STATUS RingBuf_MPMC_CellRead(void *data, RINGBUF_MPMC_t *rb) {
+    if (rb->buf == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    atomic_size_t *seq;
+    size_t pos = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+    for (;;) {
+        seq = &rb->seq[pos & rb->mask];
+        size_t s = atomic_load_explicit(seq, memory_order_acquire);
+        intptr_t dif = (intptr_t)s - (intptr_t)(pos + 1);
+        if (dif == 0) { // cell is published for this position: try to claim it
+            if (atomic_compare_exchange_weak_explicit(&rb->tail, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+            // pos reloaded by the failed CAS, retry
+        } else if (dif < 0) {
+            return RINGBUF_ERR; // no producer has published this cell yet
+        } else { // another consumer claimed pos, reload
+            pos = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+        }
+    }
+    memcpy(data, &rb->buf[(pos & rb->mask) * rb->cell_size], rb->cell_size);
+    // free the cell for the next lap: producers wait for seq == pos + size
+    atomic_store_explicit(seq, pos + rb->mask + 1, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/// @} RING_BUF_MPMC Group
@@ -0,0 +1,65 @@
+/**
+ *******************************************
+ * @file    RingBuffer_MPMC.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Header file for lock-free MPMC RingBuffer
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_MPMC_H_
+#define RING_BUF_MPMC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+
+#ifdef __STDC_NO_ATOMICS__
+#error "RingBuffer_MPMC requires C11 atomics"
+#endif
+
+#include <stdatomic.h>
+
+/**
+ * @addtogroup RING_BUF_MPMC
+ * @brief Lock-free multi-producer/multi-consumer ring buffer
+ *
+ * Bounded MPMC queue in the Vyukov style: every cell carries a
+ * sequence number, producers CAS-claim a position on head and publish
+ * the cell by bumping its sequence, consumers do the same on tail.
+ * Any number of threads may put and read concurrently with no lock.
+ * Capacity must be a power of two; operations are whole cells.
+ * @{
+ */
+
+/**
+ * @struct RINGBUF_MPMC_t
+ * @brief Lock-free MPMC ring buffer unit
+ */
+typedef struct RINGBUF_MPMC_t{
+    u8_t *buf;			 ///< Storage of the buffer
+    atomic_size_t *seq;  ///< Per-cell sequence numbers, one per cell
+    atomic_size_t tail;  ///< Dequeue position [cells], free-running
+    atomic_size_t head;  ///< Enqueue position [cells], free-running
+    size_t size;         ///< Size of buffer [cells], power of two
+    size_t mask;         ///< Index mask, size-1
+    size_t cell_size;    ///< Size of one cell [bytes]
+} RINGBUF_MPMC_t;
+
+RINGBUF_STATUS RingBuf_MPMC_Init(void *buf, atomic_size_t *seq, u16_t size, size_t cellsize, RINGBUF_MPMC_t *rb); // Init buf
+RINGBUF_STATUS RingBuf_MPMC_Clear(RINGBUF_MPMC_t *rb);			    // Clear buf (no concurrent access!)
+RINGBUF_STATUS RingBuf_MPMC_Available(u16_t *len, RINGBUF_MPMC_t *rb); // Approximate cells available to read
+
+RINGBUF_STATUS RingBuf_MPMC_CellPut(const void *data, RINGBUF_MPMC_t *rb); // Put 1 cell to the buf
+RINGBUF_STATUS RingBuf_MPMC_CellRead(void *data, RINGBUF_MPMC_t *rb); // Read 1 cell from buf
+
+/// @} RING_BUF_MPMC Group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_MPMC_H_ */
@@ -0,0 +1,169 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Mapped.c
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Source file for file-backed persistent RingBuffer mode
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+
+#include "RingBuffer_Mapped.h"
+
+#ifdef RINGBUF_HAS_MMAP
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @addtogroup RING_BUF_MAPPED
+ * @{
+ */
+
+/// File magic: "RBM1", bumped on any layout change
+#define RINGBUF_MAP_MAGIC 0x314D4252u
+
+/**
+ * @struct RINGBUF_MAP_HDR_t
+ * @brief On-disk header page, followed directly by the cell storage
+ */
+typedef struct RINGBUF_MAP_HDR_t{
+    u32_t magic;      ///< #RINGBUF_MAP_MAGIC
+    u32_t pad;        ///< Reserved, keeps the u64 fields aligned
+    u64_t size;       ///< Size of buffer [cells]
+    u64_t cell_size;  ///< Size of one cell [bytes]
+    u64_t head;       ///< Write index at the last sync
+    u64_t tail;       ///< Read index at the last sync
+    u64_t put_total;  ///< Lifetime produced at the last sync
+    u64_t read_total; ///< Lifetime consumed at the last sync
+} RINGBUF_MAP_HDR_t;
+
+/// Header page of a mapped ring sits one page below the cell storage
+static inline RINGBUF_MAP_HDR_t *ringbuf_map_hdr(RINGBUF_t *rb) {
+    return (RINGBUF_MAP_HDR_t *)(rb->buf - (size_t)sysconf(_SC_PAGESIZE));
+}
+
+/**
+ * @brief Open or create a file-backed persistent ring
+ * @note Creates the file with a fresh header when it does not exist;
+ *       an existing file must match size and cellsize exactly and the
+ *       ring resumes from its last synced indices. All regular calls
+ *       work on the instance; durability points are made with
+ *       #RingBuf_Sync. Pair with #RingBuf_FreeMapped.
+ *
+ * @param[in] path File to back the ring with
+ * @param[in] size Size of buffer [cells]
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_PARAM_ERR on geometry mismatch
+ */
+RINGBUF_STATUS RingBuf_InitMapped(const char *path, size_t size, size_t cellsize, RINGBUF_t *rb) {
+    if (path == NULL || rb == NULL || size == 0 || cellsize == 0)
+        return RINGBUF_PARAM_ERR;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t bytes = size * cellsize;
+    size_t total = page + bytes;
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+        return RINGBUF_ERR;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return RINGBUF_ERR;
+    }
+    u8_t fresh = (st.st_size == 0);
+    if (fresh && ftruncate(fd, (off_t)total) != 0) {
+        close(fd);
+        return RINGBUF_ERR;
+    }
+    if (!fresh && (size_t)st.st_size != total) {
+        close(fd);
+        return RINGBUF_PARAM_ERR;
+    }
+    u8_t *base = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd); // the mapping keeps the file open
+    if (base == MAP_FAILED)
+        return RINGBUF_ERR;
+    RINGBUF_MAP_HDR_t *hdr = (RINGBUF_MAP_HDR_t *)base;
+    if (fresh) {
+        hdr->magic = RINGBUF_MAP_MAGIC;
+        hdr->pad = 0;
+        hdr->size = size;
+        hdr->cell_size = cellsize;
+        hdr->head = hdr->tail = 0;
+        hdr->put_total = hdr->read_total = 0;
+    } else if (hdr->magic != RINGBUF_MAP_MAGIC ||
+               hdr->size != size || hdr->cell_size != cellsize) {
+        munmap(base, total);
+        return RINGBUF_PARAM_ERR;
+    }
+    RINGBUF_STATUS ist = RingBuf_InitEx(base + page, size, cellsize, rb);
+    if (ist != RINGBUF_OK) {
+        munmap(base, total);
+        return ist;
+    }
+    if ((size & (size - 1)) == 0) // mapped rings get masking for free
+        rb->mask = size - 1;
+    // classic indices must sit inside the ring; a stray header means
+    // the file is corrupt, not just unsynced
+    if (!rb->mask && (hdr->head >= size || hdr->tail >= size)) {
+        munmap(base, total);
+        return RINGBUF_ERR;
+    }
+    // resume from the last synced state
+    rb->head = (size_t)hdr->head;
+    rb->tail = (size_t)hdr->tail;
+    rb->put_total = hdr->put_total;
+    rb->read_total = hdr->read_total;
+    rb->mapped = 1;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Flush the mapped ring to its file
+ * @note Durability point: the data region is synced before the
+ *       indices, so a crash mid-sync rolls back to consistent state
+ *       instead of exposing indices that point at unwritten cells
+ *
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_Sync(RINGBUF_t *rb) {
+    if (rb == NULL || rb->buf == NULL || !rb->mapped)
+        return RINGBUF_PARAM_ERR;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    RINGBUF_MAP_HDR_t *hdr = ringbuf_map_hdr(rb);
+    if (msync(rb->buf, rb->size * rb->cell_size, MS_SYNC) != 0)
+        return RINGBUF_ERR;
+    hdr->head = rb->head;
+    hdr->tail = rb->tail;
+    hdr->put_total = rb->put_total;
+    hdr->read_total = rb->read_total;
+    if (msync((void *)hdr, page, MS_SYNC) != 0)
+        return RINGBUF_ERR;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Sync and unmap a file-backed ring
+ *
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_FreeMapped(RINGBUF_t *rb) {
+    if (rb == NULL || rb->buf == NULL || !rb->mapped)
+        return RINGBUF_PARAM_ERR;
+    RINGBUF_STATUS st = RingBuf_Sync(rb);
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    munmap((void *)ringbuf_map_hdr(rb), page + rb->size * rb->cell_size);
+    rb->buf = NULL;
+    rb->mapped = 0;
+    return st;
+}
+
+/// @} RING_BUF_MAPPED Group
+
+#endif /* RINGBUF_HAS_MMAP */
@@ -0,0 +1,50 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Mapped.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Header file for file-backed persistent RingBuffer mode
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_MAPPED_H_
+#define RING_BUF_MAPPED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+
+#ifdef RINGBUF_HAS_MMAP
+
+/**
+ * @addtogroup RING_BUF_MAPPED
+ * @brief File-backed persistent buffer mode for crash-safe spooling
+ *
+ * The ring storage is a memory-mapped file: one header page holding
+ * the geometry and indices, followed by the cell storage. Producers
+ * and consumers write straight into the mapping through the regular
+ * calls, so spooling to disk costs no extra copy and no write()
+ * syscall. #RingBuf_Sync flushes the data and then the indices to the
+ * file, making everything put before it recoverable; reopening the
+ * same path resumes from the last synced state instead of starting
+ * empty. MCU builds without an MMU skip this header (see
+ * RINGBUF_HAS_MMAP in libs.h).
+ * @{
+ */
+
+RINGBUF_STATUS RingBuf_InitMapped(const char *path, size_t size, size_t cellsize, RINGBUF_t *rb); // Open or create a file-backed ring
+RINGBUF_STATUS RingBuf_Sync(RINGBUF_t *rb); // Flush data and indices to the file
+RINGBUF_STATUS RingBuf_FreeMapped(RINGBUF_t *rb); // Sync and unmap
+
+/// @} RING_BUF_MAPPED Group
+
+#endif /* RINGBUF_HAS_MMAP */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_MAPPED_H_ */
@@ -0,0 +1,87 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Mirrored.c
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Source file for mirrored ("magic ring") RingBuffer mode
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+
+#define _GNU_SOURCE /* memfd_create */
+#include "RingBuffer_Mirrored.h"
+
+#ifdef RINGBUF_HAS_MMAP
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * @addtogroup RING_BUF_MIRRORED
+ * @{
+ */
+
+/**
+ * @brief Init ring buffer with mirrored storage
+ * @note Maps one memfd twice back-to-back, so the buffer contents are
+ *       visible at buf[i] and buf[size*cellsize + i] alike. The total
+ *       storage size (size * cellsize) must be a multiple of the page
+ *       size. Pair with #RingBuf_FreeMirrored; all regular calls work
+ *       on the instance, wrapped transfers just become single copies.
+ *
+ * @param[in] size Size of buffer [cells]
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_InitMirrored(u16_t size, size_t cellsize, RINGBUF_t *rb) {
+    size_t bytes = (size_t)size * cellsize;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    if (bytes == 0 || bytes % page != 0)
+        return RINGBUF_PARAM_ERR;
+    int fd = memfd_create("ringbuf", 0);
+    if (fd < 0)
+        return RINGBUF_ERR;
+    if (ftruncate(fd, (off_t)bytes) != 0) {
+        close(fd);
+        return RINGBUF_ERR;
+    }
+    // reserve both halves, then map the same pages into each
+    u8_t *base = mmap(NULL, bytes * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return RINGBUF_ERR;
+    }
+    if (mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, bytes * 2);
+        close(fd);
+        return RINGBUF_ERR;
+    }
+    close(fd); // mappings keep the pages alive
+    RINGBUF_STATUS st = RingBuf_Init(base, size, cellsize, rb);
+    if ((size & (size - 1)) == 0) // mirrored rings get masking for free
+        rb->mask = (size_t)size - 1;
+    rb->mirror = 1;
+    return st;
+}
+
+/**
+ * @brief Unmap mirrored ring storage
+ *
+ * @param[in] rb #RINGBUF_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_FreeMirrored(RINGBUF_t *rb) {
+    if (rb->buf == NULL || !rb->mirror)
+        return RINGBUF_PARAM_ERR;
+    munmap(rb->buf, rb->size * rb->cell_size * 2);
+    rb->buf = NULL;
+    rb->mirror = 0;
+    return RINGBUF_OK;
+}
+
+/// @} RING_BUF_MIRRORED Group
+
+#endif /* RINGBUF_HAS_MMAP */
@@ -0,0 +1,47 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Mirrored.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Header file for mirrored ("magic ring") RingBuffer mode
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_MIRRORED_H_
+#define RING_BUF_MIRRORED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+
+#ifdef RINGBUF_HAS_MMAP
+
+/**
+ * @addtogroup RING_BUF_MIRRORED
+ * @brief Virtual-memory mirrored buffer mode for hosted platforms
+ *
+ * The ring storage is one set of physical pages mapped twice
+ * back-to-back, so every read or write is a single contiguous region
+ * regardless of the wrap point: the split-copy branch disappears from
+ * DataPut/DataWatch and the claim/segment calls can expose the whole
+ * fill level as one pointer. MCU builds without an MMU keep using the
+ * plain init paths; this header is empty there (see RINGBUF_HAS_MMAP
+ * in libs.h).
+ * @{
+ */
+
+RINGBUF_STATUS RingBuf_InitMirrored(u16_t size, size_t cellsize, RINGBUF_t *rb); // Init with mirrored mapping
+RINGBUF_STATUS RingBuf_FreeMirrored(RINGBUF_t *rb); // Unmap mirrored storage
+
+/// @} RING_BUF_MIRRORED Group
+
+#endif /* RINGBUF_HAS_MMAP */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_MIRRORED_H_ */
@@ -0,0 +1,221 @@
+/**
+ *******************************************
+ * @file    RingBuffer_SPSC.c
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Source file for lock-free SPSC RingBuffer
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+
+#include "RingBuffer_SPSC.h"
+
+/**
+ * @addtogroup RING_BUF_SPSC
+ * @{
+ */
+
+/**
+ * @brief Init SPSC ring buffer
+ * @note One cell of the buffer is kept free, so usable capacity is size-1
+ *
+ * @param[in] buf Pointer to the allocated buffer
+ * @param[in] size Size of buffer [cells]
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_Init(void *buf, u16_t size, size_t cellsize, RINGBUF_SPSC_t *rb) {
+    rb->size = size; // size of array
+    rb->cell_size = cellsize; // size of 1 cell of array
+    rb->buf = buf;      // set pointer to buffer
+    atomic_init(&rb->head, 0);
+    atomic_init(&rb->tail, 0);
+    return rb->buf ? RINGBUF_OK : RINGBUF_PARAM_ERR;
+}
+
+/**
+ * @brief Clear SPSC ring buffer
+ * @note Not thread-safe: call only when neither side is active
+ *
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_Clear(RINGBUF_SPSC_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    atomic_store_explicit(&rb->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&rb->tail, 0, memory_order_relaxed);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Check available size to read
+ * @note Safe to call from either side; from the consumer the result
+ *       can only grow concurrently, from the producer only shrink
+ *
+ * @param[out] len Cells available to read
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_Available(u16_t *len, RINGBUF_SPSC_t *rb) {
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;
+    size_t head = atomic_load_explicit(&rb->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_acquire);
+    if (head < tail)
+        *len = (u16_t)(rb->size - tail + head);
+    else
+        *len = (u16_t)(head - tail);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Check free size to write
+ *
+ * @param[out] len Cells free to write
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_Free(u16_t *len, RINGBUF_SPSC_t *rb) {
+    u16_t avail = 0;
+    RINGBUF_STATUS st = RingBuf_SPSC_Available(&avail, rb);
+    if (st != RINGBUF_OK)
+        return st;
+    *len = (u16_t)(rb->size - 1 - avail); // one cell is kept free
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Put byte to the buffer (producer side)
+ *
+ * @param[in] data Data byte to be put
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_BytePut(const u8_t data, RINGBUF_SPSC_t *rb) {
+    return RingBuf_SPSC_DataPut(&data, 1, rb);
+}
+
+/**
+ * @brief Put 1 cell to the buffer (producer side)
+ * @param[in] data Pointer to data
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_CellPut(const void *data, RINGBUF_SPSC_t *rb) {
+    return RingBuf_SPSC_DataPut(data, 1, rb);
+}
+
+/**
+ * @brief Put some data to the buffer (producer side)
+ * @note Head is loaded relaxed (we are its only writer), tail with
+ *       acquire, and the new head is published with one release store,
+ *       so the consumer never observes cells before their contents
+ *
+ * @param[in] data Data to be put
+ * @param[in] len Length of data to be written [cells]
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_DataPut(const void *data, u16_t len, RINGBUF_SPSC_t *rb) {
+    if (rb->buf == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    size_t head = atomic_load_explicit(&rb->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_acquire);
+    // free cells, one is always kept empty
+    size_t free;
+    if (tail > head)
+        free = tail - head - 1;
+    else
+        free = rb->size - head + tail - 1;
+    if (len > free)
+        return RINGBUF_OVERFLOW;
+    const char *input = data; // recast pointer
+    // available space in the end of buffer
+    size_t space = rb->size - head;
+    size_t s_addr = 0;
+    size_t rem = len;
+    if (rem > space) { // if len > available space
+        // copy data to available space
+        memcpy(&rb->buf[head * rb->cell_size], &input[s_addr * rb->cell_size], space * rb->cell_size);
+        // next writing will start from 0
+        head = 0;
+        s_addr = space;
+        rem -= space;
+    }
+    // copy all the data to the buf storage
+    memcpy(&rb->buf[head * rb->cell_size], &input[s_addr * rb->cell_size], rem * rb->cell_size);
+    head += rem;
+    if (head >= rb->size)
+        head = 0;
+    // publish the new head once, after all the data is in place
+    atomic_store_explicit(&rb->head, head, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Read next byte from the buffer (consumer side)
+ *
+ * @param[out] data Data byte from the buffer
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_ByteRead(u8_t *data, RINGBUF_SPSC_t *rb) {
+    return RingBuf_SPSC_DataRead(data, 1, rb);
+}
+
+/**
+ * @brief Read 1 cell from buf (consumer side)
+ * @param[out] data Data cell from the buffer
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_SPSC_CellRead(void *data, RINGBUF_SPSC_t *rb) {
+    return RingBuf_SPSC_DataRead(data, 1, rb);
+}
+
+/**
+ * @brief Read some next data from the buffer (consumer side)
+ * @note Tail is loaded relaxed (we are its only writer), head with
+ *       acquire, and the new tail is published with one release store
+ *
+ * @param[out] data Data from the buffer
+ * @param[in] len Length of data to be read [cells]
+ * @param[in] rb #RINGBUF_SPSC_t structure instance
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR if not enough data
+ */
+RINGBUF_STATUS RingBuf_SPSC_DataRead(void *data, u16_t len, RINGBUF_SPSC_t *rb) {
+    if (rb->buf == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&rb->head, memory_order_acquire);
+    // cells available to read
+    size_t avail;
+    if (head < tail)
+        avail = rb->size - tail + head;
+    else
+        avail = head - tail;
+    if (len > avail)
+        return RINGBUF_ERR;
+    char *output = data; // recast pointer
+    // available space in the end of buffer
+    size_t space = rb->size - tail;
+    size_t s_addr = 0;
+    size_t rem = len;
+    if (rem > space) { // if len > available space
+        // copy data from available space
+        memcpy(&output[s_addr * rb->cell_size], &rb->buf[tail * rb->cell_size], space * rb->cell_size);
+        // next reading will start from 0
+        tail = 0;
+        s_addr = space;
+        rem -= space;
+    }
+    // copy all the data from the buf storage
+    memcpy(&output[s_addr * rb->cell_size], &rb->buf[tail * rb->cell_size], rem * rb->cell_size);
+    tail += rem;
+    if (tail >= rb->size)
+        tail = 0;
+    // publish the new tail once, after all the data is copied out
+    atomic_store_explicit(&rb->tail, tail, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/// @} RING_BUF_SPSC Group
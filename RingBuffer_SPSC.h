@@ -0,0 +1,87 @@
+/**
+ *******************************************
+ * @file    RingBuffer_SPSC.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Header file for lock-free SPSC RingBuffer
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_SPSC_H_
+#define RING_BUF_SPSC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+
+#ifdef __STDC_NO_ATOMICS__
+#error "RingBuffer_SPSC requires C11 atomics"
+#endif
+
+#include <stdatomic.h>
+
+/**
+ * @addtogroup RING_BUF_SPSC
+ * @brief Lock-free single-producer/single-consumer ring buffer
+ *
+ * Head is written only by the producer, tail only by the consumer.
+ * Index publication uses release stores, the opposite side reads with
+ * acquire loads, so put/read may run concurrently (e.g. ISR producer
+ * vs main-loop consumer) without any critical section.
+ * One cell is kept free to distinguish full from empty.
+ *
+ * Define RINGBUF_SPSC_CACHE_ALIGN (globally, for every translation
+ * unit) to pad tail and head onto separate cache lines and keep the
+ * read-mostly fields away from both. This removes false sharing
+ * between producer and consumer cores at the cost of a larger struct;
+ * leave it undefined on embedded targets to keep the small layout.
+ * Align the storage itself with #RINGBUF_CACHE_ALIGNED from libs.h.
+ * @{
+ */
+
+#ifdef RINGBUF_SPSC_CACHE_ALIGN
+#define RINGBUF_SPSC_ALIGN RINGBUF_CACHE_ALIGNED
+#else
+#define RINGBUF_SPSC_ALIGN
+#endif
+
+/**
+ * @struct RINGBUF_SPSC_t
+ * @brief Lock-free SPSC ring buffer unit
+ */
+typedef struct RINGBUF_SPSC_t{
+    u8_t *buf;			 ///< Storage of the buffer
+    RINGBUF_SPSC_ALIGN
+    atomic_size_t tail;  ///< Place of read point [cells], written by consumer only
+    RINGBUF_SPSC_ALIGN
+    atomic_size_t head;  ///< Place of write point [cells], written by producer only
+    RINGBUF_SPSC_ALIGN
+    size_t size;         ///< Size of buffer [cells]
+    size_t cell_size;    ///< Size of one cell [bytes]
+} RINGBUF_SPSC_t;
+
+RINGBUF_STATUS RingBuf_SPSC_Init(void *buf, u16_t size, size_t cellsize, RINGBUF_SPSC_t *rb); // Init buf
+RINGBUF_STATUS RingBuf_SPSC_Clear(RINGBUF_SPSC_t *rb);			   // Clear buf (no concurrent access!)
+RINGBUF_STATUS RingBuf_SPSC_Available(u16_t *len, RINGBUF_SPSC_t *rb); // Cells available to read
+RINGBUF_STATUS RingBuf_SPSC_Free(u16_t *len, RINGBUF_SPSC_t *rb);	   // Cells free to write
+
+// Put: add data to buffer (producer side only)
+RINGBUF_STATUS RingBuf_SPSC_BytePut(const u8_t data, RINGBUF_SPSC_t *rb); // Put byte to the buf
+RINGBUF_STATUS RingBuf_SPSC_CellPut(const void *data, RINGBUF_SPSC_t *rb); // Put 1 cell to the buf
+RINGBUF_STATUS RingBuf_SPSC_DataPut(const void *data, u16_t len, RINGBUF_SPSC_t *rb); // Put data to the buf
+
+// Read: get data & flush it (consumer side only)
+RINGBUF_STATUS RingBuf_SPSC_ByteRead(u8_t *data, RINGBUF_SPSC_t *rb); // Read byte from buf
+RINGBUF_STATUS RingBuf_SPSC_CellRead(void *data, RINGBUF_SPSC_t *rb); // Read 1 cell from buf
+RINGBUF_STATUS RingBuf_SPSC_DataRead(void *data, u16_t len, RINGBUF_SPSC_t *rb); // Read data from buf
+
+/// @} RING_BUF_SPSC Group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_SPSC_H_ */
@@ -0,0 +1,292 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Shm.c
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Source file for shared-memory cross-process RingBuffer
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+
+#include "RingBuffer_Shm.h"
+
+#ifdef RINGBUF_HAS_MMAP
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @addtogroup RING_BUF_SHM
+ * @{
+ */
+
+/// Segment magic: "RBS1", bumped on any layout change
+#define RINGBUF_SHM_MAGIC 0x31534252u
+
+/// Cell storage address: offset from the local mapping base, no pointers stored
+static inline u8_t *ringbuf_shm_buf(RINGBUF_SHM_t *rb) {
+    return (u8_t *)rb + rb->buf_off;
+}
+
+/// Round the control block up so the cell storage starts on its own cache line
+static inline size_t ringbuf_shm_off(void) {
+    return (sizeof(RINGBUF_SHM_t) + RINGBUF_CACHELINE - 1) & ~((size_t)RINGBUF_CACHELINE - 1);
+}
+
+/**
+ * @brief Create a shared-memory ring (producer side)
+ * @note Fails if the name already exists: the creator owns the
+ *       lifetime and removes the name with #RingBuf_UnlinkShm. The
+ *       peer may attach as soon as this returns. One cell is kept
+ *       free, so usable capacity is size-1.
+ *
+ * @param[in] name POSIX shm name ("/...")
+ * @param[in] size Size of buffer [cells]
+ * @param[in] cellsize Size of 1 cell [bytes]
+ * @param[out] rb Mapped control block
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_InitShm(const char *name, size_t size, size_t cellsize, RINGBUF_SHM_t **rb) {
+    if (name == NULL || rb == NULL || size < 2 || cellsize == 0)
+        return RINGBUF_PARAM_ERR;
+    size_t off = ringbuf_shm_off();
+    size_t total = off + size * cellsize;
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0)
+        return RINGBUF_ERR;
+    if (ftruncate(fd, (off_t)total) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return RINGBUF_ERR;
+    }
+    RINGBUF_SHM_t *shm = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd); // the mapping keeps the segment open
+    if (shm == MAP_FAILED) {
+        shm_unlink(name);
+        return RINGBUF_ERR;
+    }
+    shm->magic = RINGBUF_SHM_MAGIC;
+    shm->size = size;
+    shm->cell_size = cellsize;
+    shm->buf_off = off;
+    atomic_init(&shm->head, 0);
+    atomic_init(&shm->tail, 0);
+    // publish the header before the peer may trust it
+    atomic_thread_fence(memory_order_release);
+    shm->ready = 1;
+    *rb = shm;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Map an existing shared-memory ring (consumer side)
+ * @note Validates the magic and waits for nothing: attach after the
+ *       creator's #RingBuf_InitShm has returned
+ *
+ * @param[in] name POSIX shm name ("/...")
+ * @param[out] rb Mapped control block
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_AttachShm(const char *name, RINGBUF_SHM_t **rb) {
+    if (name == NULL || rb == NULL)
+        return RINGBUF_PARAM_ERR;
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+        return RINGBUF_ERR;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(RINGBUF_SHM_t)) {
+        close(fd);
+        return RINGBUF_ERR;
+    }
+    RINGBUF_SHM_t *shm = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm == MAP_FAILED)
+        return RINGBUF_ERR;
+    if (shm->ready != 1 || shm->magic != RINGBUF_SHM_MAGIC ||
+        (size_t)st.st_size != shm->buf_off + shm->size * shm->cell_size) {
+        munmap(shm, (size_t)st.st_size);
+        return RINGBUF_ERR;
+    }
+    atomic_thread_fence(memory_order_acquire); // pairs with the init fence
+    *rb = shm;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Unmap a shared-memory ring
+ * @note The segment and its contents stay alive for the other side;
+ *       only #RingBuf_UnlinkShm removes the name
+ *
+ * @param[in] rb Mapped control block
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_DetachShm(RINGBUF_SHM_t *rb) {
+    if (rb == NULL)
+        return RINGBUF_PARAM_ERR;
+    munmap(rb, rb->buf_off + rb->size * rb->cell_size);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Remove a shared-memory ring name
+ * @note Existing mappings keep working; the segment is freed once the
+ *       last side detaches
+ *
+ * @param[in] name POSIX shm name ("/...")
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_UnlinkShm(const char *name) {
+    if (name == NULL)
+        return RINGBUF_PARAM_ERR;
+    return shm_unlink(name) == 0 ? RINGBUF_OK : RINGBUF_ERR;
+}
+
+/**
+ * @brief Check available size to read
+ * @note Safe from either side, like #RingBuf_SPSC_Available
+ *
+ * @param[out] len Cells available to read
+ * @param[in] rb Mapped control block
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_Shm_Available(size_t *len, RINGBUF_SHM_t *rb) {
+    if (rb == NULL || len == NULL) return RINGBUF_PARAM_ERR;
+    size_t head = atomic_load_explicit(&rb->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_acquire);
+    if (head < tail)
+        *len = rb->size - tail + head;
+    else
+        *len = head - tail;
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Check free size to write
+ *
+ * @param[out] len Cells free to write
+ * @param[in] rb Mapped control block
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_Shm_Free(size_t *len, RINGBUF_SHM_t *rb) {
+    size_t avail = 0;
+    RINGBUF_STATUS st = RingBuf_Shm_Available(&avail, rb);
+    if (st != RINGBUF_OK)
+        return st;
+    *len = rb->size - 1 - avail; // one cell is kept free
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Put 1 cell to the buffer (producer side)
+ * @param[in] data Pointer to data
+ * @param[in] rb Mapped control block
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_Shm_CellPut(const void *data, RINGBUF_SHM_t *rb) {
+    return RingBuf_Shm_DataPut(data, 1, rb);
+}
+
+/**
+ * @brief Put some data to the buffer (producer side)
+ * @note Same index discipline as #RingBuf_SPSC_DataPut: head loaded
+ *       relaxed, tail with acquire, new head published with one
+ *       release store after all the data is in place
+ *
+ * @param[in] data Data to be put
+ * @param[in] len Length of data to be written [cells]
+ * @param[in] rb Mapped control block
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_Shm_DataPut(const void *data, size_t len, RINGBUF_SHM_t *rb) {
+    if (rb == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    u8_t *buf = ringbuf_shm_buf(rb);
+    size_t head = atomic_load_explicit(&rb->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_acquire);
+    // free cells, one is always kept empty
+    size_t free;
+    if (tail > head)
+        free = tail - head - 1;
+    else
+        free = rb->size - head + tail - 1;
+    if (len > free)
+        return RINGBUF_OVERFLOW;
+    const char *input = data; // recast pointer
+    // available space in the end of buffer
+    size_t space = rb->size - head;
+    size_t s_addr = 0;
+    size_t rem = len;
+    if (rem > space) { // if len > available space
+        memcpy(&buf[head * rb->cell_size], &input[s_addr * rb->cell_size], space * rb->cell_size);
+        head = 0;
+        s_addr = space;
+        rem -= space;
+    }
+    memcpy(&buf[head * rb->cell_size], &input[s_addr * rb->cell_size], rem * rb->cell_size);
+    head += rem;
+    if (head >= rb->size)
+        head = 0;
+    // publish the new head once, after all the data is in place
+    atomic_store_explicit(&rb->head, head, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/**
+ * @brief Read 1 cell from the buffer (consumer side)
+ * @param[out] data Data cell from the buffer
+ * @param[in] rb Mapped control block
+ * @return #RINGBUF_STATUS enum
+ */
+RINGBUF_STATUS RingBuf_Shm_CellRead(void *data, RINGBUF_SHM_t *rb) {
+    return RingBuf_Shm_DataRead(data, 1, rb);
+}
+
+/**
+ * @brief Read some next data from the buffer (consumer side)
+ * @note Same index discipline as #RingBuf_SPSC_DataRead: tail loaded
+ *       relaxed, head with acquire, new tail published with one
+ *       release store after all the data is copied out
+ *
+ * @param[out] data Data from the buffer
+ * @param[in] len Length of data to be read [cells]
+ * @param[in] rb Mapped control block
+ * @return #RINGBUF_STATUS enum, #RINGBUF_ERR if not enough data
+ */
+RINGBUF_STATUS RingBuf_Shm_DataRead(void *data, size_t len, RINGBUF_SHM_t *rb) {
+    if (rb == NULL || data == NULL) return RINGBUF_PARAM_ERR;
+    u8_t *buf = ringbuf_shm_buf(rb);
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&rb->head, memory_order_acquire);
+    // cells available to read
+    size_t avail;
+    if (head < tail)
+        avail = rb->size - tail + head;
+    else
+        avail = head - tail;
+    if (len > avail)
+        return RINGBUF_ERR;
+    char *output = data; // recast pointer
+    // available space in the end of buffer
+    size_t space = rb->size - tail;
+    size_t s_addr = 0;
+    size_t rem = len;
+    if (rem > space) { // if len > available space
+        memcpy(&output[s_addr * rb->cell_size], &buf[tail * rb->cell_size], space * rb->cell_size);
+        tail = 0;
+        s_addr = space;
+        rem -= space;
+    }
+    memcpy(&output[s_addr * rb->cell_size], &buf[tail * rb->cell_size], rem * rb->cell_size);
+    tail += rem;
+    if (tail >= rb->size)
+        tail = 0;
+    // publish the new tail once, after all the data is copied out
+    atomic_store_explicit(&rb->tail, tail, memory_order_release);
+    return RINGBUF_OK;
+}
+
+/// @} RING_BUF_SHM Group
+
+#endif /* RINGBUF_HAS_MMAP */
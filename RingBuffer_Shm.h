@@ -0,0 +1,76 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Shm.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Header file for shared-memory cross-process RingBuffer
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_SHM_H_
+#define RING_BUF_SHM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+#include "RingBuffer_SPSC.h" /* RINGBUF_SPSC_ALIGN */
+
+#ifdef RINGBUF_HAS_MMAP
+
+/**
+ * @addtogroup RING_BUF_SHM
+ * @brief Relocatable SPSC ring in POSIX shared memory
+ *
+ * One producer process and one consumer process share a single
+ * zero-copy ring through shm_open. The segment maps at a different
+ * address in each process, so the layout holds no pointers: the cell
+ * storage lives at a fixed offset from the control block and every
+ * access recomputes the address from the mapping base. Indices use
+ * the same acquire/release discipline as RingBuffer_SPSC, which works
+ * across processes exactly as across threads. The creator calls
+ * #RingBuf_InitShm, the peer #RingBuf_AttachShm; one cell is kept
+ * free, so usable capacity is size-1. Hosted platforms only (see
+ * RINGBUF_HAS_MMAP in libs.h).
+ * @{
+ */
+
+/**
+ * @struct RINGBUF_SHM_t
+ * @brief Control block at the start of the shared segment
+ * @note Lives inside the mapping: never copy it, hold the pointer
+ *       returned by init/attach and pass that to the calls
+ */
+typedef struct RINGBUF_SHM_t{
+    u32_t magic;         ///< Layout magic, checked on attach
+    volatile u32_t ready; ///< Set by the creator once the header is complete
+    u64_t size;          ///< Size of buffer [cells]
+    u64_t cell_size;     ///< Size of one cell [bytes]
+    u64_t buf_off;       ///< Cell storage offset from the segment base [bytes]
+    RINGBUF_SPSC_ALIGN atomic_size_t tail; ///< Consumer index [cells]
+    RINGBUF_SPSC_ALIGN atomic_size_t head; ///< Producer index [cells]
+} RINGBUF_SHM_t;
+
+RINGBUF_STATUS RingBuf_InitShm(const char *name, size_t size, size_t cellsize, RINGBUF_SHM_t **rb); // Create and map (producer side)
+RINGBUF_STATUS RingBuf_AttachShm(const char *name, RINGBUF_SHM_t **rb); // Map an existing ring (consumer side)
+RINGBUF_STATUS RingBuf_DetachShm(RINGBUF_SHM_t *rb); // Unmap, segment stays alive
+RINGBUF_STATUS RingBuf_UnlinkShm(const char *name); // Remove the segment name
+
+RINGBUF_STATUS RingBuf_Shm_Available(size_t *len, RINGBUF_SHM_t *rb); // Cells to read
+RINGBUF_STATUS RingBuf_Shm_Free(size_t *len, RINGBUF_SHM_t *rb); // Cells free to write
+RINGBUF_STATUS RingBuf_Shm_CellPut(const void *data, RINGBUF_SHM_t *rb); // Put 1 cell
+RINGBUF_STATUS RingBuf_Shm_DataPut(const void *data, size_t len, RINGBUF_SHM_t *rb); // Put data
+RINGBUF_STATUS RingBuf_Shm_CellRead(void *data, RINGBUF_SHM_t *rb); // Read 1 cell
+RINGBUF_STATUS RingBuf_Shm_DataRead(void *data, size_t len, RINGBUF_SHM_t *rb); // Read data
+
+/// @} RING_BUF_SHM Group
+
+#endif /* RINGBUF_HAS_MMAP */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_SHM_H_ */
@@ -0,0 +1,88 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Static.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Compile-time fixed-capacity ring generator
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_STATIC_H_
+#define RING_BUF_STATIC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+
+/**
+ * @addtogroup RING_BUF_STATIC
+ * @brief Fully specialized static rings for the smallest targets
+ *
+ * Where RingBuffer_Typed.h fixes only the cell size, this generator
+ * fixes everything: #RINGBUF_DEFINE stamps out a static storage array
+ * and inline put/read/watch with the capacity as a compile-time
+ * constant. The `% capacity` wrap folds to a mask for power-of-two
+ * capacities and to a cheap compare otherwise, the bounds are visible
+ * to the optimizer (drain loops unroll and vectorize), and per-ring
+ * RAM is two indices instead of a full #RINGBUF_t. One cell is kept
+ * free, so usable capacity is capacity-1, as in the classic checked
+ * modes. The generated rings are static to the translation unit and
+ * need no init call.
+ * @{
+ */
+
+/**
+ * @brief Generate a static fixed-capacity ring
+ * @param name Prefix of the generated functions and storage
+ * @param type Cell type
+ * @param capacity Size of the ring [cells], compile-time constant
+ */
+#define RINGBUF_DEFINE(name, type, capacity)                                   \
+static type name##_storage[capacity];                                          \
+static volatile size_t name##_head = 0;                                        \
+static volatile size_t name##_tail = 0;                                        \
+static inline void name##_Clear(void) {                                        \
+    name##_head = name##_tail = 0;                                             \
+}                                                                              \
+static inline size_t name##_Available(void) {                                  \
+    size_t head = name##_head, tail = name##_tail;                             \
+    return (head < tail) ? (capacity) - tail + head : head - tail;             \
+}                                                                              \
+static inline size_t name##_Free(void) {                                       \
+    return (capacity) - 1 - name##_Available(); /* one cell kept free */       \
+}                                                                              \
+static inline RINGBUF_STATUS name##_Put(type val) {                            \
+    size_t head = name##_head;                                                 \
+    size_t next = (head + 1) % (capacity); /* constant-folded wrap */          \
+    if (next == name##_tail)                                                   \
+        return RINGBUF_OVERFLOW;                                               \
+    name##_storage[head] = val;                                                \
+    name##_head = next; /* publish with a single store */                      \
+    return RINGBUF_OK;                                                         \
+}                                                                              \
+static inline RINGBUF_STATUS name##_Watch(type *val) {                         \
+    size_t tail = name##_tail;                                                 \
+    if (name##_head == tail)                                                   \
+        return RINGBUF_ERR;                                                    \
+    *val = name##_storage[tail];                                               \
+    return RINGBUF_OK;                                                         \
+}                                                                              \
+static inline RINGBUF_STATUS name##_Read(type *val) {                          \
+    size_t tail = name##_tail;                                                 \
+    if (name##_head == tail)                                                   \
+        return RINGBUF_ERR;                                                    \
+    *val = name##_storage[tail];                                               \
+    name##_tail = (tail + 1) % (capacity); /* publish with a single store */   \
+    return RINGBUF_OK;                                                         \
+}
+
+/// @} RING_BUF_STATIC Group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_STATIC_H_ */
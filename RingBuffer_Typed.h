@@ -0,0 +1,79 @@
+/**
+ *******************************************
+ * @file    RingBuffer_Typed.h
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Header-only typed accessors for RingBuffer lib
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ */
+#ifndef RING_BUF_TYPED_H_
+#define RING_BUF_TYPED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "RingBuffer.h"
+
+/**
+ * @addtogroup RING_BUF_TYPED
+ * @brief Compile-time specialized accessors for fixed cell sizes
+ *
+ * The generic RingBuf_DataPut/DataRead path multiplies by the runtime
+ * cell_size and calls memcpy with a runtime length, which the compiler
+ * cannot inline. The accessors below fix the cell size at compile time:
+ * copies become plain assignments and the whole put/read inlines into
+ * the caller. The ring must be initialized with cell_size equal to
+ * sizeof of the accessor type.
+ * @{
+ */
+
+/**
+ * @brief Generate typed put/read/watch accessors for one cell type
+ * @param tname Name suffix of the generated functions
+ * @param type Cell type, must match the ring's cell_size
+ */
+#define RINGBUF_TYPED_DEFINE(tname, type)                                     \
+static inline RINGBUF_STATUS RingBuf_Put_##tname(type val, RINGBUF_t *rb) {   \
+    if (rb->buf == NULL) return RINGBUF_PARAM_ERR;                            \
+    size_t idx = rb->mask ? (rb->head & rb->mask) : rb->head;                 \
+    ((type *)rb->buf)[idx] = val; /* plain assignment, no memcpy */           \
+    size_t head = rb->head + 1;                                               \
+    if (!rb->mask && head >= rb->size)                                        \
+        head = 0;                                                             \
+    rb->head = head; /* publish with a single store */                        \
+    return RINGBUF_OK;                                                        \
+}                                                                             \
+static inline RINGBUF_STATUS RingBuf_Watch_##tname(type *val, RINGBUF_t *rb) {\
+    if (rb->buf == NULL || val == NULL) return RINGBUF_PARAM_ERR;             \
+    size_t idx = rb->mask ? (rb->tail & rb->mask) : rb->tail;                 \
+    *val = ((const type *)rb->buf)[idx];                                      \
+    return RINGBUF_OK;                                                        \
+}                                                                             \
+static inline RINGBUF_STATUS RingBuf_Read_##tname(type *val, RINGBUF_t *rb) { \
+    RINGBUF_STATUS st = RingBuf_Watch_##tname(val, rb);                       \
+    if (st != RINGBUF_OK)                                                     \
+        return st;                                                            \
+    size_t tail = rb->tail + 1;                                               \
+    if (!rb->mask && tail >= rb->size)                                        \
+        tail = 0;                                                             \
+    rb->tail = tail; /* publish with a single store */                        \
+    return RINGBUF_OK;                                                        \
+}
+
+// Ready-made accessors for the base cell types from libs.h
+RINGBUF_TYPED_DEFINE(u8, u8_t)
+RINGBUF_TYPED_DEFINE(u16, u16_t)
+RINGBUF_TYPED_DEFINE(u32, u32_t)
+RINGBUF_TYPED_DEFINE(u64, u64_t)
+RINGBUF_TYPED_DEFINE(fl, fl_t)
+
+/// @} RING_BUF_TYPED Group
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_BUF_TYPED_H_ */
@@ -0,0 +1,168 @@
+/**
+ *******************************************
+ * @file    bench.c
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Benchmark harness for RingBuffer lib
+ * @note    Prints one CSV row per benchmark so results can be
+ *          tracked per commit; build target: RingBufferBench
+ *******************************************
+ */
+
+#include "libs.h"
+#include "RingBuffer.h"
+#include "RingBuffer_SPSC.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/// Cells in every benchmark ring
+#define BENCH_RING_CELLS 1024u
+/// Handoff latency samples collected in the SPSC benchmark
+#define BENCH_LAT_SAMPLES 20000u
+
+static u64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64_t)ts.tv_sec * 1000000000ull + (u64_t)ts.tv_nsec;
+}
+
+static void csv_row(const char *name, size_t cell_bytes, size_t batch_cells,
+                    int threads, u64_t ops, u64_t ns,
+                    u64_t p50_ns, u64_t p99_ns) {
+    double s = (double)ns / 1e9;
+    double ops_s = (double)ops / s;
+    double mb_s = ops_s * (double)cell_bytes * (double)batch_cells / 1e6;
+    printf("%s,%zu,%zu,%d,%llu,%llu,%.0f,%.1f,%llu,%llu\n",
+           name, cell_bytes, batch_cells, threads,
+           (unsigned long long)ops, (unsigned long long)ns,
+           ops_s, mb_s,
+           (unsigned long long)p50_ns, (unsigned long long)p99_ns);
+}
+
+/**
+ * @brief Single-threaded put+read throughput for one cell size
+ * @param[in] cell_bytes Size of one cell
+ * @param[in] batch_cells Cells per DataPut/DataRead call
+ * @param[in] wrap_heavy Pick a batch count that forces a wrap on most transfers
+ */
+static void bench_single(size_t cell_bytes, size_t batch_cells, bool wrap_heavy) {
+    static u8_t storage[BENCH_RING_CELLS * 4096];
+    static u8_t scratch[BENCH_RING_CELLS * 4096];
+    RINGBUF_t rb;
+    RingBuf_InitPow2(storage, BENCH_RING_CELLS, cell_bytes, &rb);
+    if (wrap_heavy) {
+        // offset the indices so most batches straddle the wrap point
+        u16_t skew = (u16_t)(BENCH_RING_CELLS - batch_cells / 2 - 1);
+        RingBuf_DataPut(scratch, skew, &rb);
+        RingBuf_Skip(skew, &rb);
+    }
+    u64_t target_cells = 16 * 1000 * 1000 / cell_bytes + 250000;
+    u64_t iters = target_cells / batch_cells;
+    u64_t t0 = now_ns();
+    for (u64_t i = 0; i < iters; i++) {
+        RingBuf_DataPut(scratch, (u16_t)batch_cells, &rb);
+        RingBuf_DataRead(scratch, (u16_t)batch_cells, &rb);
+    }
+    u64_t ns = now_ns() - t0;
+    csv_row(wrap_heavy ? "single_putread_wrap" : "single_putread",
+            cell_bytes, batch_cells, 1, iters, ns, 0, 0);
+}
+
+typedef struct {
+    RINGBUF_SPSC_t *rb;
+    u64_t cells;
+} spsc_arg_t;
+
+static void *spsc_producer(void *p) {
+    spsc_arg_t *a = p;
+    u64_t v = 0;
+    for (u64_t i = 0; i < a->cells; i++) {
+        while (RingBuf_SPSC_CellPut(&v, a->rb) != RINGBUF_OK)
+            sched_yield(); // ring full; yield so single-core rigs make progress
+        v++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Two-thread SPSC throughput, one u64 cell per operation
+ */
+static void bench_spsc_throughput(void) {
+    static u64_t storage[BENCH_RING_CELLS];
+    RINGBUF_SPSC_t rb;
+    RingBuf_SPSC_Init(storage, BENCH_RING_CELLS, sizeof(u64_t), &rb);
+    spsc_arg_t arg = { &rb, 2 * 1000 * 1000 };
+    pthread_t prod;
+    u64_t t0 = now_ns();
+    pthread_create(&prod, NULL, spsc_producer, &arg);
+    u64_t v;
+    for (u64_t i = 0; i < arg.cells; i++) {
+        while (RingBuf_SPSC_CellRead(&v, &rb) != RINGBUF_OK)
+            sched_yield(); // ring empty; yield so single-core rigs make progress
+    }
+    pthread_join(prod, NULL);
+    u64_t ns = now_ns() - t0;
+    csv_row("spsc_throughput", sizeof(u64_t), 1, 2, arg.cells, ns, 0, 0);
+}
+
+static void *spsc_ts_producer(void *p) {
+    spsc_arg_t *a = p;
+    for (u64_t i = 0; i < a->cells; i++) {
+        u64_t ts = now_ns();
+        while (RingBuf_SPSC_CellPut(&ts, a->rb) != RINGBUF_OK) {
+            sched_yield();
+            ts = now_ns(); // keep the stamp fresh while the ring is full
+        }
+    }
+    return NULL;
+}
+
+static int cmp_u64(const void *a, const void *b) {
+    u64_t x = *(const u64_t *)a, y = *(const u64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Two-thread SPSC handoff latency, p50/p99 over timestamped cells
+ * @note Uses a 2-cell ring so the measurement is producer-to-consumer
+ *       handoff, not queue occupancy
+ */
+static void bench_spsc_latency(void) {
+    static u64_t storage[2];
+    static u64_t samples[BENCH_LAT_SAMPLES];
+    RINGBUF_SPSC_t rb;
+    RingBuf_SPSC_Init(storage, 2, sizeof(u64_t), &rb);
+    spsc_arg_t arg = { &rb, BENCH_LAT_SAMPLES };
+    pthread_t prod;
+    u64_t t0 = now_ns();
+    pthread_create(&prod, NULL, spsc_ts_producer, &arg);
+    for (u64_t i = 0; i < arg.cells; i++) {
+        u64_t ts;
+        while (RingBuf_SPSC_CellRead(&ts, &rb) != RINGBUF_OK)
+            sched_yield(); // ring empty; yield so single-core rigs make progress
+        samples[i] = now_ns() - ts;
+    }
+    pthread_join(prod, NULL);
+    u64_t ns = now_ns() - t0;
+    qsort(samples, BENCH_LAT_SAMPLES, sizeof(u64_t), cmp_u64);
+    csv_row("spsc_latency", sizeof(u64_t), 1, 2, arg.cells, ns,
+            samples[BENCH_LAT_SAMPLES / 2],
+            samples[(u64_t)(BENCH_LAT_SAMPLES * 0.99)]);
+}
+
+int main(void) {
+    printf("benchmark,cell_bytes,batch_cells,threads,ops,ns_total,ops_per_s,mb_per_s,p50_ns,p99_ns\n");
+    // generic path across the cell sizes that matter to us
+    size_t cells[] = { 1, 4, 64, 4096 };
+    for (size_t i = 0; i < sizeof(cells) / sizeof(cells[0]); i++) {
+        bench_single(cells[i], 1, false);   // per-cell cost
+        bench_single(cells[i], 64, false);  // batched, wrap-free
+        bench_single(cells[i], 64, true);   // batched, wrap-heavy
+    }
+    bench_spsc_throughput();
+    bench_spsc_latency();
+    return 0;
+}
@@ -25,4 +25,15 @@ typedef uint64_t u64_t; ///< 64-bit unsigned
 typedef int64_t i64_t;  ///< 64-bit signed
 typedef float fl_t;		///< float type
 
+#if defined(__linux__)
+#define RINGBUF_HAS_MMAP 1 ///< Platform can map ring storage (mirrored/persistent modes)
+#endif
+
+#ifndef RINGBUF_CACHELINE
+#define RINGBUF_CACHELINE 64 ///< Cache line size [bytes], override per target
+#endif
+
+/// Align an object (e.g. a ring storage buffer) to a cache line
+#define RINGBUF_CACHE_ALIGNED _Alignas(RINGBUF_CACHELINE)
+
 #endif /* LIBS_H_ */
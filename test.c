@@ -0,0 +1,678 @@
+/**
+ *******************************************
+ * @file    test.c
+ * @author  Dmitriy Semenov / Crazy_Geeks
+ * @version 1.0
+ * @date	28-August-2026
+ * @brief   Correctness and stress tests for the RingBuffer lib
+ * @note    https://crazygeeks.ru/c-ringbuffer/
+ *******************************************
+ *
+ * Four layers, all assert-based:
+ *  1. wrap-boundary units for every put/read/watch call, run over a
+ *     grid of sizes and cell sizes in classic and pow2 modes, plus
+ *     units for the batch, external-head, migrate and eviction paths;
+ *  2. randomized differential testing against a naive reference
+ *     queue, same operation stream applied to both;
+ *  3. threaded stress runs: two-thread SPSC and multi-producer MPMC,
+ *     both verifying sequence integrity;
+ *  4. round-trips of the mmap-backed modes (mirrored, persistent
+ *     file, shared-memory across fork), compiled on Linux only.
+ * The stress iteration counts are bounded so CI stays fast; pass a
+ * larger count as argv[1] for soak runs.
+ */
+
+// The whole suite does its work inside assert expressions; keep them
+// alive in optimized (-DNDEBUG) trees or the binary tests nothing
+#undef NDEBUG
+#include <assert.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "RingBuffer.h"
+#include "RingBuffer_Group.h"
+#include "RingBuffer_MPMC.h"
+#include "RingBuffer_SPSC.h"
+
+#ifdef RINGBUF_HAS_MMAP
+#include <sys/wait.h>
+#include <unistd.h>
+#include "RingBuffer_Mapped.h"
+#include "RingBuffer_Mirrored.h"
+#include "RingBuffer_Shm.h"
+#endif
+
+/* ------------------------------------------------------------------ */
+/* 1. Wrap-boundary units                                             */
+/* ------------------------------------------------------------------ */
+
+/// Fill a cell with a recognizable per-cell pattern
+static void pattern_cell(u8_t *cell, size_t cellsize, u32_t seq) {
+    for (size_t b = 0; b < cellsize; b++)
+        cell[b] = (u8_t)(seq * 31u + b * 7u + 1u);
+}
+
+static void check_cell(const u8_t *cell, size_t cellsize, u32_t seq) {
+    for (size_t b = 0; b < cellsize; b++)
+        assert(cell[b] == (u8_t)(seq * 31u + b * 7u + 1u));
+}
+
+/// Exercise every put/read/watch call around the wrap point of one ring
+static void unit_ring(u16_t size, size_t cellsize, int pow2) {
+    u8_t *store = malloc((size_t)size * cellsize);
+    u8_t *in = malloc((size_t)size * cellsize);
+    u8_t *out = malloc((size_t)size * cellsize);
+    RINGBUF_t rb;
+    if (pow2)
+        assert(RingBuf_InitPow2(store, size, cellsize, &rb) == RINGBUF_OK);
+    else
+        assert(RingBuf_Init(store, size, cellsize, &rb) == RINGBUF_OK);
+    u16_t cap = pow2 ? size : size - 1; // classic checked modes keep one free
+    RingBuf_SetPolicy(RINGBUF_POLICY_DROP_NEWEST, &rb);
+
+    u32_t seq_in = 0, seq_out = 0;
+    u16_t avail;
+
+    // skew the indices so every transfer length hits the boundary
+    for (u16_t skew = 0; skew < size; skew++) {
+        // single-cell calls at the current offset
+        pattern_cell(in, cellsize, seq_in);
+        assert(RingBuf_CellPut(in, &rb) == RINGBUF_OK);
+        seq_in++;
+        assert(RingBuf_CellWatch(out, &rb) == RINGBUF_OK);
+        check_cell(out, cellsize, seq_out);
+        assert(RingBuf_CellRead(out, &rb) == RINGBUF_OK);
+        check_cell(out, cellsize, seq_out);
+        seq_out++;
+
+        // block transfers of every length that fits
+        for (u16_t len = 1; len <= cap; len++) {
+            for (u16_t i = 0; i < len; i++)
+                pattern_cell(&in[i * cellsize], cellsize, seq_in + i);
+            assert(RingBuf_DataPut(in, len, &rb) == RINGBUF_OK);
+            assert(RingBuf_Available(&avail, &rb) == RINGBUF_OK && avail == len);
+            // watching more than is buffered must fail, not read past head
+            if (len < size)
+                assert(RingBuf_DataWatch(out, len + 1, &rb) == RINGBUF_ERR);
+            assert(RingBuf_DataWatch(out, len, &rb) == RINGBUF_OK);
+            for (u16_t i = 0; i < len; i++)
+                check_cell(&out[i * cellsize], cellsize, seq_in + i);
+            // watch at an offset
+            if (len > 1) {
+                assert(RingBuf_WatchAt(1, out, len - 1, &rb) == RINGBUF_OK);
+                check_cell(out, cellsize, seq_in + 1);
+                assert(RingBuf_WatchAt(len, out, 1, &rb) == RINGBUF_ERR);
+            }
+            memset(out, 0, (size_t)size * cellsize);
+            assert(RingBuf_DataRead(out, len, &rb) == RINGBUF_OK);
+            for (u16_t i = 0; i < len; i++)
+                check_cell(&out[i * cellsize], cellsize, seq_in + i);
+            seq_in += len;
+            seq_out = seq_in;
+            assert(RingBuf_Available(&avail, &rb) == RINGBUF_OK && avail == 0);
+        }
+
+        // an oversized put is rejected whole
+        assert(RingBuf_DataPut(in, cap + 1, &rb) == RINGBUF_OVERFLOW);
+
+        // zero-copy claim/commit round-trip of one cell
+        u8_t *ptr; u16_t contig;
+        assert(RingBuf_WriteClaim(1, &ptr, &contig, &rb) == RINGBUF_OK);
+        assert(contig >= 1);
+        pattern_cell(ptr, cellsize, seq_in);
+        assert(RingBuf_WriteCommit(1, &rb) == RINGBUF_OK);
+        seq_in++;
+        assert(RingBuf_ReadClaim(1, &ptr, &contig, &rb) == RINGBUF_OK);
+        check_cell(ptr, cellsize, seq_out);
+        assert(RingBuf_ReadCommit(1, &rb) == RINGBUF_OK);
+        seq_out++;
+
+        // segments of a part-full ring cover exactly the fill level
+        assert(RingBuf_DataPut(in, cap / 2 + 1, &rb) == RINGBUF_OK);
+        u8_t *s1, *s2; u16_t l1, l2;
+        assert(RingBuf_GetReadSegments(&s1, &l1, &s2, &l2, &rb) == RINGBUF_OK);
+        assert(l1 + l2 == cap / 2 + 1);
+        assert(RingBuf_Skip(cap / 2 + 1, &rb) == RINGBUF_OK);
+        seq_in += cap / 2 + 1;
+        seq_out = seq_in;
+    }
+
+    // byte calls on byte rings
+    if (cellsize == 1) {
+        u8_t b;
+        for (u16_t i = 0; i < cap; i++)
+            assert(RingBuf_BytePut((u8_t)(i * 13u), &rb) == RINGBUF_OK);
+        assert(RingBuf_BytePut(0xAA, &rb) == RINGBUF_OVERFLOW);
+        assert(RingBuf_ByteWatch(&b, &rb) == RINGBUF_OK && b == 0);
+        for (u16_t i = 0; i < cap; i++)
+            assert(RingBuf_ByteRead(&b, &rb) == RINGBUF_OK && b == (u8_t)(i * 13u));
+    }
+
+    // UpTo variants clip at the boundary instead of failing
+    u16_t actual;
+    for (u16_t i = 0; i < cap; i++)
+        pattern_cell(&in[i * cellsize], cellsize, i);
+    assert(RingBuf_DataPutUpTo(in, size, &actual, &rb) == RINGBUF_OK && actual == cap);
+    assert(RingBuf_DataReadUpTo(out, size, &actual, &rb) == RINGBUF_OK && actual == cap);
+    for (u16_t i = 0; i < cap; i++)
+        check_cell(&out[i * cellsize], cellsize, i);
+
+    free(store);
+    free(in);
+    free(out);
+}
+
+static void test_wrap_units(void) {
+    static const u16_t sizes[] = { 4, 5, 8, 16, 17, 64 };
+    static const size_t cellsizes[] = { 1, 2, 4, 12 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (size_t c = 0; c < sizeof(cellsizes) / sizeof(cellsizes[0]); c++) {
+            unit_ring(sizes[s], cellsizes[c], 0);
+            if ((sizes[s] & (sizes[s] - 1)) == 0)
+                unit_ring(sizes[s], cellsizes[c], 1);
+        }
+    }
+    printf("wrap units: ok\n");
+}
+
+/// Write claims clamp to the free space and never expose unread cells
+static void test_claim_clamp(void) {
+    u8_t store[8], *p; u16_t contig; u8_t b;
+    RINGBUF_t rb;
+    assert(RingBuf_Init(store, 8, 1, &rb) == RINGBUF_OK);
+    for (int i = 0; i < 5; i++)
+        assert(RingBuf_BytePut((u8_t)i, &rb) == RINGBUF_OK);
+    // 5 unread, cap 7: a claim of 4 clamps to the 2 free cells
+    assert(RingBuf_WriteClaim(4, &p, &contig, &rb) == RINGBUF_OK && contig == 2);
+    p[0] = 5; p[1] = 6;
+    assert(RingBuf_WriteCommit(2, &rb) == RINGBUF_OK);
+    // full ring claims zero
+    assert(RingBuf_WriteClaim(1, &p, &contig, &rb) == RINGBUF_OK && contig == 0);
+    for (int i = 0; i < 7; i++)
+        assert(RingBuf_ByteRead(&b, &rb) == RINGBUF_OK && b == i);
+    // wrap point still clamps contiguity: head at 7, 7 free, 1 contiguous
+    assert(RingBuf_WriteClaim(7, &p, &contig, &rb) == RINGBUF_OK && contig == 1);
+    // pow2 mode uses every cell
+    RINGBUF_t rp; u8_t sp[8];
+    assert(RingBuf_InitPow2(sp, 8, 1, &rp) == RINGBUF_OK);
+    assert(RingBuf_WriteClaim(8, &p, &contig, &rp) == RINGBUF_OK && contig == 8);
+    assert(RingBuf_WriteCommit(8, &rp) == RINGBUF_OK);
+    assert(RingBuf_WriteClaim(1, &p, &contig, &rp) == RINGBUF_OK && contig == 0);
+    printf("claim clamp: ok\n");
+}
+
+/// Batch commits keep the produced - consumed == fill invariant
+static void test_batch_totals(void) {
+    u8_t store[8], b; u16_t avail;
+    RINGBUF_t rb; RINGBUF_CURSOR_t cur; RINGBUF_STATS_t st;
+    assert(RingBuf_Init(store, 8, 1, &rb) == RINGBUF_OK);
+    assert(RingBuf_BatchBegin(&rb, &cur) == RINGBUF_OK);
+    for (u8_t i = 0; i < 5; i++)
+        RingBuf_BatchPutCell(&cur, &i);
+    assert(RingBuf_BatchCommit(&cur) == RINGBUF_OK);
+    assert(RingBuf_Stats(&st, &rb) == RINGBUF_OK);
+    assert(RingBuf_Available(&avail, &rb) == RINGBUF_OK);
+    assert(st.produced == 5 && st.consumed == 0);
+    assert(st.produced - st.consumed == avail);
+    assert(RingBuf_BatchReadBegin(&rb, &cur) == RINGBUF_OK);
+    for (u8_t i = 0; i < 3; i++) {
+        RingBuf_BatchReadCell(&cur, &b);
+        assert(b == i);
+    }
+    assert(RingBuf_BatchReadCommit(&cur) == RINGBUF_OK);
+    assert(RingBuf_Stats(&st, &rb) == RINGBUF_OK);
+    assert(RingBuf_Available(&avail, &rb) == RINGBUF_OK);
+    assert(st.produced == 5 && st.consumed == 3);
+    assert(st.produced - st.consumed == avail);
+    printf("batch totals: ok\n");
+}
+
+/// A grouped ring fed through the batch API wakes RingBufGroup_Next
+static void test_batch_group_notify(void) {
+    u8_t store[8];
+    RINGBUF_t rb, *ready;
+    RINGBUF_GROUP_t group;
+    RINGBUF_CURSOR_t cur;
+    assert(RingBuf_Init(store, 8, 1, &rb) == RINGBUF_OK);
+    assert(RingBufGroup_Init(&group) == RINGBUF_OK);
+    assert(RingBufGroup_Add(&group, &rb) == RINGBUF_OK);
+    assert(RingBufGroup_Next(&group, &ready) == RINGBUF_ERR); // nothing ready
+    assert(RingBuf_BatchBegin(&rb, &cur) == RINGBUF_OK);
+    u8_t v = 42;
+    RingBuf_BatchPutCell(&cur, &v);
+    assert(RingBuf_BatchCommit(&cur) == RINGBUF_OK);
+    assert(RingBufGroup_Next(&group, &ready) == RINGBUF_OK && ready == &rb);
+    printf("batch group notify: ok\n");
+}
+
+/// Hardware-producer mode: an ISR publishes head positions after DMA
+static void test_external_head(void) {
+    u8_t dma[16], out[16];
+    RINGBUF_t rb;
+    u16_t avail;
+    assert(RingBuf_InitExternalHead(dma, 16, 1, &rb) == RINGBUF_OK);
+    assert(RingBuf_Available(&avail, &rb) == RINGBUF_OK && avail == 0);
+    memcpy(dma, "abcde", 5); // "hardware" wrote 5 cells
+    assert(RingBuf_UpdateHead(5, &rb) == RINGBUF_OK);
+    assert(RingBuf_Available(&avail, &rb) == RINGBUF_OK && avail == 5);
+    assert(RingBuf_DataRead(out, 5, &rb) == RINGBUF_OK && memcmp(out, "abcde", 5) == 0);
+    // 14 more cells, the published position wraps to 3
+    for (int i = 0; i < 14; i++) dma[(5 + i) % 16] = (u8_t)(0x30 + i);
+    assert(RingBuf_UpdateHead(3, &rb) == RINGBUF_OK);
+    assert(RingBuf_Available(&avail, &rb) == RINGBUF_OK && avail == 14);
+    assert(RingBuf_DataRead(out, 14, &rb) == RINGBUF_OK);
+    for (int i = 0; i < 14; i++) assert(out[i] == 0x30 + i);
+    RINGBUF_STATS_t st;
+    assert(RingBuf_Stats(&st, &rb) == RINGBUF_OK && st.produced == 19 && st.consumed == 19);
+    // out-of-range position and UpdateHead on a normal ring are refused
+    assert(RingBuf_UpdateHead(16, &rb) == RINGBUF_PARAM_ERR);
+    RINGBUF_t r2; u8_t s2[8];
+    assert(RingBuf_Init(s2, 8, 1, &r2) == RINGBUF_OK);
+    assert(RingBuf_UpdateHead(1, &r2) == RINGBUF_PARAM_ERR);
+    printf("external head: ok\n");
+}
+
+/// Online resize keeps the unread data across grow and shrink
+static void test_migrate(void) {
+    u8_t a[16], b[64], c[8], out[64], x;
+    RINGBUF_t rb;
+    size_t avail;
+    assert(RingBuf_Init(a, 16, 1, &rb) == RINGBUF_OK);
+    // fill with wrap so the unread region spans two segments
+    for (int i = 0; i < 10; i++) assert(RingBuf_BytePut((u8_t)i, &rb) == RINGBUF_OK);
+    for (int i = 0; i < 8; i++) assert(RingBuf_ByteRead(&x, &rb) == RINGBUF_OK);
+    for (int i = 10; i < 22; i++) assert(RingBuf_BytePut((u8_t)i, &rb) == RINGBUF_OK);
+    assert(RingBuf_Migrate(b, 64, &rb) == RINGBUF_OK); // grow
+    assert(rb.buf == b && rb.size == 64 && rb.tail == 0 && rb.head == 14);
+    assert(RingBuf_AvailableEx(&avail, &rb) == RINGBUF_OK && avail == 14);
+    for (int i = 0; i < 6; i++) assert(RingBuf_ByteRead(&x, &rb) == RINGBUF_OK && x == 8 + i);
+    assert(RingBuf_Migrate(c, 8, &rb) == RINGBUF_OVERFLOW); // shrink below fill refused
+    assert(RingBuf_DataRead(out, 4, &rb) == RINGBUF_OK);
+    assert(RingBuf_Migrate(c, 8, &rb) == RINGBUF_OK); // fits now (4 left, cap 7)
+    for (int i = 0; i < 4; i++) assert(RingBuf_ByteRead(&x, &rb) == RINGBUF_OK && x == 18 + i);
+    // pow2 ring: non-pow2 target refused, pow2 target keeps masking
+    RINGBUF_t rp; u8_t p[16], q[32];
+    assert(RingBuf_InitPow2(p, 16, 1, &rp) == RINGBUF_OK);
+    for (int i = 0; i < 16; i++) assert(RingBuf_BytePut((u8_t)i, &rp) == RINGBUF_OK);
+    assert(RingBuf_Migrate(q, 24, &rp) == RINGBUF_PARAM_ERR);
+    assert(RingBuf_Migrate(q, 32, &rp) == RINGBUF_OK);
+    assert(rp.mask == 31);
+    for (int i = 0; i < 16; i++) assert(RingBuf_ByteRead(&x, &rp) == RINGBUF_OK && x == i);
+    printf("migrate: ok\n");
+}
+
+/// Time-window eviction drops exactly the stale cells, wrap included
+static void test_eviction(void) {
+    u32_t store[16]; u64_t tsarr[16];
+    RINGBUF_t rb;
+    u32_t v; u64_t t;
+    size_t ev, avail;
+    assert(RingBuf_InitPow2(store, 16, 4, &rb) == RINGBUF_OK);
+    assert(RingBuf_CellPutTs(&v, 1, &rb) == RINGBUF_PARAM_ERR); // not attached yet
+    assert(RingBuf_AttachTs(tsarr, &rb) == RINGBUF_OK);
+    for (u32_t i = 0; i < 16; i++) { v = i; assert(RingBuf_CellPutTs(&v, 100 + 10 * i, &rb) == RINGBUF_OK); }
+    assert(RingBuf_EvictOlderThan(100, &ev, &rb) == RINGBUF_OK && ev == 0); // equal is kept
+    assert(RingBuf_EvictOlderThan(145, &ev, &rb) == RINGBUF_OK && ev == 5);
+    assert(RingBuf_CellWatchTs(&v, &t, &rb) == RINGBUF_OK && v == 5 && t == 150);
+    assert(RingBuf_EvictOlderThan(1000, &ev, &rb) == RINGBUF_OK && ev == 11); // everything stale
+    assert(RingBuf_AvailableEx(&avail, &rb) == RINGBUF_OK && avail == 0);
+    // classic mode with the stale region spanning the wrap point
+    RINGBUF_t rc; u8_t sc[10], b, junk[10]; u64_t tc[10];
+    assert(RingBuf_Init(sc, 10, 1, &rc) == RINGBUF_OK);
+    assert(RingBuf_AttachTs(tc, &rc) == RINGBUF_OK);
+    for (int i = 0; i < 7; i++) { b = (u8_t)i; assert(RingBuf_CellPutTs(&b, i, &rc) == RINGBUF_OK); }
+    assert(RingBuf_DataRead(junk, 6, &rc) == RINGBUF_OK);
+    for (int i = 7; i < 14; i++) { b = (u8_t)i; assert(RingBuf_CellPutTs(&b, i, &rc) == RINGBUF_OK); }
+    assert(RingBuf_EvictOlderThan(11, &ev, &rc) == RINGBUF_OK && ev == 5);
+    assert(RingBuf_CellWatchTs(&b, &t, &rc) == RINGBUF_OK && b == 11 && t == 11);
+    RINGBUF_STATS_t st; // evictions count as consumed
+    assert(RingBuf_Stats(&st, &rc) == RINGBUF_OK && st.produced - st.consumed == 3);
+    printf("eviction: ok\n");
+}
+
+/* ------------------------------------------------------------------ */
+/* 2. Differential testing against a naive reference queue            */
+/* ------------------------------------------------------------------ */
+
+/// Naive bounded FIFO of cells, the obviously-correct reference
+typedef struct {
+    u8_t *data;
+    size_t cap, cellsize, count, front;
+} ref_queue_t;
+
+static void ref_push(ref_queue_t *q, const u8_t *cells, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        size_t slot = (q->front + q->count) % q->cap;
+        memcpy(&q->data[slot * q->cellsize], &cells[i * q->cellsize], q->cellsize);
+        q->count++;
+    }
+}
+
+static void ref_pop(ref_queue_t *q, u8_t *cells, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (cells)
+            memcpy(&cells[i * q->cellsize], &q->data[q->front * q->cellsize], q->cellsize);
+        q->front = (q->front + 1) % q->cap;
+        q->count--;
+    }
+}
+
+static void diff_ring(u16_t size, size_t cellsize, int pow2, u32_t iters) {
+    u8_t *store = malloc((size_t)size * cellsize);
+    u8_t *tmp_a = malloc((size_t)size * cellsize);
+    u8_t *tmp_b = malloc((size_t)size * cellsize);
+    ref_queue_t ref = { malloc((size_t)size * cellsize), size, cellsize, 0, 0 };
+    RINGBUF_t rb;
+    if (pow2)
+        assert(RingBuf_InitPow2(store, size, cellsize, &rb) == RINGBUF_OK);
+    else
+        assert(RingBuf_Init(store, size, cellsize, &rb) == RINGBUF_OK);
+    RingBuf_SetPolicy(RINGBUF_POLICY_DROP_NEWEST, &rb);
+    u16_t cap = pow2 ? size : size - 1;
+
+    u32_t seq = 0;
+    for (u32_t it = 0; it < iters; it++) {
+        u16_t avail;
+        assert(RingBuf_Available(&avail, &rb) == RINGBUF_OK);
+        assert(avail == ref.count); // fill levels always agree
+        u16_t len = (u16_t)(rand() % size + 1);
+        switch (rand() % 5) {
+        case 0: // put: both accept or both reject
+            for (u16_t i = 0; i < len; i++)
+                pattern_cell(&tmp_a[i * cellsize], cellsize, seq + i);
+            if (len <= cap - ref.count) {
+                assert(RingBuf_DataPut(tmp_a, len, &rb) == RINGBUF_OK);
+                ref_push(&ref, tmp_a, len);
+                seq += len;
+            } else {
+                assert(RingBuf_DataPut(tmp_a, len, &rb) == RINGBUF_OVERFLOW);
+            }
+            break;
+        case 1: // read: contents must match the reference exactly
+            if (len <= ref.count) {
+                assert(RingBuf_DataRead(tmp_a, len, &rb) == RINGBUF_OK);
+                ref_pop(&ref, tmp_b, len);
+                assert(memcmp(tmp_a, tmp_b, len * cellsize) == 0);
+            } else {
+                assert(RingBuf_DataRead(tmp_a, len, &rb) == RINGBUF_ERR);
+            }
+            break;
+        case 2: // watch: non-destructive, both orders
+            if (len <= ref.count) {
+                assert(RingBuf_DataWatch(tmp_a, len, &rb) == RINGBUF_OK);
+                for (u16_t i = 0; i < len; i++)
+                    assert(memcmp(&tmp_a[i * cellsize],
+                                  &ref.data[((ref.front + i) % ref.cap) * cellsize],
+                                  cellsize) == 0);
+            } else if (len <= size) {
+                assert(RingBuf_DataWatch(tmp_a, len, &rb) == RINGBUF_ERR);
+            }
+            break;
+        case 3: // skip
+            if (len <= ref.count) {
+                assert(RingBuf_Skip(len, &rb) == RINGBUF_OK);
+                ref_pop(&ref, NULL, len);
+            } else {
+                assert(RingBuf_Skip(len, &rb) == RINGBUF_OVERFLOW);
+            }
+            break;
+        case 4: { // clipped put/read pair
+            u16_t actual;
+            for (u16_t i = 0; i < len; i++)
+                pattern_cell(&tmp_a[i * cellsize], cellsize, seq + i);
+            assert(RingBuf_DataPutUpTo(tmp_a, len, &actual, &rb) == RINGBUF_OK);
+            assert(actual == (len <= cap - ref.count ? len : cap - ref.count));
+            ref_push(&ref, tmp_a, actual);
+            seq += actual;
+            break;
+        }
+        }
+    }
+    free(store);
+    free(tmp_a);
+    free(tmp_b);
+    free(ref.data);
+}
+
+static void test_differential(void) {
+    srand(20260828);
+    diff_ring(7, 1, 0, 50000);
+    diff_ring(16, 1, 0, 50000);
+    diff_ring(16, 4, 1, 50000);
+    diff_ring(33, 12, 0, 50000);
+    diff_ring(64, 3, 1, 50000);
+    printf("differential: ok\n");
+}
+
+/* ------------------------------------------------------------------ */
+/* 3. Two-thread SPSC stress                                          */
+/* ------------------------------------------------------------------ */
+
+typedef struct {
+    RINGBUF_SPSC_t *rb;
+    u32_t count;
+} spsc_args_t;
+
+static void *spsc_producer(void *p) {
+    spsc_args_t *a = p;
+    u32_t batch[32];
+    u32_t next = 0;
+    while (next < a->count) {
+        u16_t n = 0;
+        while (n < 32 && next + n < a->count) {
+            batch[n] = next + n;
+            n++;
+        }
+        if (RingBuf_SPSC_DataPut(batch, n, a->rb) == RINGBUF_OK)
+            next += n;
+        else
+            sched_yield(); // single-core machines need the consumer to run
+    }
+    return NULL;
+}
+
+static void test_spsc_stress(u32_t count) {
+    static u32_t store[1024];
+    RINGBUF_SPSC_t rb;
+    assert(RingBuf_SPSC_Init(store, 1024, sizeof(u32_t), &rb) == RINGBUF_OK);
+    spsc_args_t args = { &rb, count };
+    pthread_t th;
+    assert(pthread_create(&th, NULL, spsc_producer, &args) == 0);
+    u32_t expect = 0;
+    u32_t batch[32];
+    while (expect < count) {
+        u16_t avail = 0;
+        RingBuf_SPSC_Available(&avail, &rb);
+        if (avail == 0) {
+            sched_yield();
+            continue;
+        }
+        u16_t n = avail < 32 ? avail : 32;
+        assert(RingBuf_SPSC_DataRead(batch, n, &rb) == RINGBUF_OK);
+        for (u16_t i = 0; i < n; i++)
+            assert(batch[i] == expect + i); // sequence integrity
+        expect += n;
+    }
+    pthread_join(th, NULL);
+    u16_t avail = 0;
+    RingBuf_SPSC_Available(&avail, &rb);
+    assert(avail == 0);
+    printf("spsc stress: ok (%u cells)\n", count);
+}
+
+#define MPMC_PRODUCERS 4
+
+typedef struct {
+    RINGBUF_MPMC_t *rb;
+    u32_t id;
+    u32_t count;
+} mpmc_args_t;
+
+/// Each producer tags its cells: id in the top byte, sequence below
+static void *mpmc_producer(void *p) {
+    mpmc_args_t *a = p;
+    for (u32_t i = 0; i < a->count;) {
+        u32_t v = (a->id << 24) | i;
+        if (RingBuf_MPMC_CellPut(&v, a->rb) == RINGBUF_OK)
+            i++;
+        else
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void test_mpmc_stress(u32_t count) {
+    static u32_t store[1024];
+    static atomic_size_t seq[1024];
+    RINGBUF_MPMC_t rb;
+    assert(count <= 0xFFFFFFu); // sequence must fit below the id byte
+    assert(RingBuf_MPMC_Init(store, seq, 1024, sizeof(u32_t), &rb) == RINGBUF_OK);
+    mpmc_args_t args[MPMC_PRODUCERS];
+    pthread_t th[MPMC_PRODUCERS];
+    for (u32_t p = 0; p < MPMC_PRODUCERS; p++) {
+        args[p] = (mpmc_args_t){ &rb, p, count };
+        assert(pthread_create(&th[p], NULL, mpmc_producer, &args[p]) == 0);
+    }
+    u32_t next[MPMC_PRODUCERS] = { 0 };
+    u64_t total = (u64_t)count * MPMC_PRODUCERS;
+    for (u64_t got = 0; got < total;) {
+        u32_t v;
+        if (RingBuf_MPMC_CellRead(&v, &rb) != RINGBUF_OK) {
+            sched_yield();
+            continue;
+        }
+        u32_t id = v >> 24;
+        assert(id < MPMC_PRODUCERS);
+        // with a single consumer each producer's sequence stays FIFO
+        assert((v & 0xFFFFFFu) == next[id]);
+        next[id]++;
+        got++;
+    }
+    for (u32_t p = 0; p < MPMC_PRODUCERS; p++)
+        pthread_join(th[p], NULL);
+    u16_t avail = 0;
+    RingBuf_MPMC_Available(&avail, &rb);
+    assert(avail == 0);
+    printf("mpmc stress: ok (%u producers x %u cells)\n", MPMC_PRODUCERS, count);
+}
+
+#ifdef RINGBUF_HAS_MMAP
+
+/* ------------------------------------------------------------------ */
+/* 4. mmap-backed modes                                                */
+/* ------------------------------------------------------------------ */
+
+/// Mirrored mode: a read claim spanning the wrap point stays contiguous
+static void test_mirrored(void) {
+    RINGBUF_t rb;
+    u8_t in[3000], out[3000], *p;
+    u16_t contig;
+    assert(RingBuf_InitMirrored(4096, 1, &rb) == RINGBUF_OK); // page multiple
+    assert(rb.mirror == 1);
+    for (int i = 0; i < 3000; i++) in[i] = (u8_t)(i * 13u + 5u);
+    assert(RingBuf_DataPut(in, 3000, &rb) == RINGBUF_OK);
+    assert(RingBuf_DataRead(out, 3000, &rb) == RINGBUF_OK && memcmp(in, out, 3000) == 0);
+    // head/tail at 3000: this batch wraps in the underlying buffer
+    assert(RingBuf_DataPut(in, 3000, &rb) == RINGBUF_OK);
+    assert(RingBuf_ReadClaim(3000, &p, &contig, &rb) == RINGBUF_OK && contig == 3000);
+    assert(memcmp(p, in, 3000) == 0); // one linear view, no split
+    assert(RingBuf_ReadCommit(3000, &rb) == RINGBUF_OK);
+    assert(RingBuf_FreeMirrored(&rb) == RINGBUF_OK);
+    printf("mirrored: ok\n");
+}
+
+/// Persistent mode: data and indices survive a close/reopen cycle
+static void test_mapped(void) {
+    const char *path = "/tmp/ringbuf_test_mapped.ring";
+    RINGBUF_t rb;
+    u32_t v;
+    size_t avail;
+    unlink(path); // leftovers from a previous run
+    assert(RingBuf_InitMapped(path, 1024, 4, &rb) == RINGBUF_OK);
+    assert(rb.mask == 1023 && rb.mapped == 1);
+    for (u32_t i = 0; i < 700; i++) { v = i * 3; assert(RingBuf_CellPut(&v, &rb) == RINGBUF_OK); }
+    for (u32_t i = 0; i < 100; i++) { assert(RingBuf_CellRead(&v, &rb) == RINGBUF_OK); assert(v == i * 3); }
+    assert(RingBuf_FreeMapped(&rb) == RINGBUF_OK);
+    // reopen: resumes with 600 cells in flight
+    assert(RingBuf_InitMapped(path, 1024, 4, &rb) == RINGBUF_OK);
+    assert(RingBuf_AvailableEx(&avail, &rb) == RINGBUF_OK && avail == 600);
+    for (u32_t i = 100; i < 700; i++) { assert(RingBuf_CellRead(&v, &rb) == RINGBUF_OK); assert(v == i * 3); }
+    RINGBUF_STATS_t st; // lifetime totals are persisted too
+    assert(RingBuf_Stats(&st, &rb) == RINGBUF_OK && st.produced == 700);
+    // geometry mismatch is refused
+    RINGBUF_t r2;
+    assert(RingBuf_InitMapped(path, 512, 4, &r2) == RINGBUF_PARAM_ERR);
+    assert(RingBuf_FreeMapped(&rb) == RINGBUF_OK);
+    unlink(path);
+    printf("mapped: ok\n");
+}
+
+/// Shared-memory mode: producer and forked consumer, separate mappings
+static void test_shm(u32_t count) {
+    const char *name = "/ringbuf_test_shm";
+    RINGBUF_SHM_t *prod;
+    size_t n;
+    RingBuf_UnlinkShm(name); // leftovers from a previous run
+    assert(RingBuf_InitShm(name, 64, sizeof(u32_t), &prod) == RINGBUF_OK);
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) { // consumer process: fresh attach, own mapping address
+        RINGBUF_SHM_t *cons;
+        if (RingBuf_AttachShm(name, &cons) != RINGBUF_OK)
+            _exit(1);
+        u32_t v, expect = 0;
+        while (expect < count) {
+            if (RingBuf_Shm_CellRead(&v, cons) == RINGBUF_OK) {
+                if (v != expect)
+                    _exit(1);
+                expect++;
+            } else
+                sched_yield();
+        }
+        RingBuf_DetachShm(cons);
+        _exit(0);
+    }
+    u32_t batch[8];
+    for (u32_t next = 0; next < count;) {
+        u32_t cnt = 0;
+        while (cnt < 8 && next + cnt < count) { batch[cnt] = next + cnt; cnt++; }
+        if (RingBuf_Shm_DataPut(batch, cnt, prod) == RINGBUF_OK)
+            next += cnt;
+        else
+            sched_yield();
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0); // sequence held
+    assert(RingBuf_Shm_Available(&n, prod) == RINGBUF_OK && n == 0);
+    assert(RingBuf_DetachShm(prod) == RINGBUF_OK);
+    assert(RingBuf_UnlinkShm(name) == RINGBUF_OK);
+    printf("shm: ok (%u cells)\n", count);
+}
+
+#endif /* RINGBUF_HAS_MMAP */
+
+int main(int argc, char **argv) {
+    u32_t spsc_count = (argc > 1) ? (u32_t)strtoul(argv[1], NULL, 0) : 1000000u;
+    test_wrap_units();
+    test_claim_clamp();
+    test_batch_totals();
+    test_batch_group_notify();
+    test_external_head();
+    test_migrate();
+    test_eviction();
+    test_differential();
+    test_spsc_stress(spsc_count);
+    test_mpmc_stress(spsc_count / 8);
+#ifdef RINGBUF_HAS_MMAP
+    test_mirrored();
+    test_mapped();
+    test_shm(spsc_count / 20);
+#endif
+    printf("all tests passed\n");
+    return 0;
+}